@@ -0,0 +1,134 @@
+#ifndef CPP17_ITERATING_PROBLEMS_BENCH_HPP
+#define CPP17_ITERATING_PROBLEMS_BENCH_HPP
+
+#include <algorithm> // std::sort, std::min
+#include <chrono> // std::chrono::xx
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <iostream> // std::ostream
+#include <iterator> // std::output_iterator_tag
+#include <string> // std::string
+#include <vector> // std::vector
+
+#if __has_include(<sys/resource.h>)
+#include <sys/resource.h> // getrusage
+#define BENCH_HAS_RUSAGE
+#endif
+
+// Sink for values computed only for timing purposes. The compiler has to
+// assume the value is read, hence it cannot drop the work producing it.
+template <typename T>
+inline void
+do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile auto *p = reinterpret_cast<const volatile char *>(&value);
+    static_cast<void>(*p);
+#endif
+}
+
+// Output iterator discarding the values, which are still "used" (see
+// above): an engine writing to it does all the work, but nothing is output
+struct BenchSink {
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    auto &operator*() { return *this; }
+    auto &operator++() { return *this; }
+    auto &operator++(int) { return *this; }
+
+    template <typename T>
+    auto &operator=(const T &value) {
+        do_not_optimize(value);
+        return *this;
+    }
+};
+
+// Fill v up to size values repeating its first n ones (a longer input from
+// a testcase) and return the new size
+template <typename T>
+auto
+bench_repeat(std::vector<T> &v, std::size_t n, std::size_t size) {
+    v.resize(size);
+    for (auto i = n; n and i < size; ++i)
+        v[i] = v[i - n];
+    return size;
+}
+
+// Statistics of a benchmark, times are seconds per repetition
+struct BenchStats {
+    std::size_t reps = 0; // timed repetitions
+    std::size_t elems = 0; // elements processed per repetition
+    double min = 0, median = 0, p99 = 0;
+
+    auto ns_per_elem() const { return elems ? median * 1e9 / elems : 0.0; }
+};
+
+// Peak resident set size of the process in KB (0 if unknown)
+inline long
+bench_maxrss() {
+#ifdef BENCH_HAS_RUSAGE
+    auto usage = rusage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss; // KB under Linux
+#endif
+    return 0;
+}
+
+// Run f "warmup" times untimed and then "reps" times timing each run
+template <typename F>
+auto
+bench_run(const F &f, int reps, std::size_t elems, int warmup = 1) {
+    while (warmup-- > 0)
+        f(); // caches, branch predictors, allocator pools ...
+
+    auto times = std::vector<double>{};
+    times.reserve(reps);
+    while (reps-- > 0) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::
+            duration_cast<std::chrono::duration<double>>(stop - start).count());
+    }
+    auto stats = BenchStats{times.size(), elems};
+    if (times.empty())
+        return stats;
+
+    std::sort(times.begin(), times.end());
+    const auto last = times.size() - 1;
+    stats.min = times.front();
+    stats.median = times[last / 2];
+    stats.p99 = times[std::min(last, (times.size() * 99 + 99) / 100 - 1)];
+    return stats;
+}
+
+// Header of the report table, matching the rows from bench_report
+inline void
+bench_header(std::ostream &os) {
+    os << "| solution | elems | reps | min (s) | median (s) | p99 (s)"
+       << " | ns/elem | maxrss (KB) |\n"
+       << "|---|---:|---:|---:|---:|---:|---:|---:|\n";
+}
+
+// Row of the report table, name is usually argv[0]
+inline void
+bench_row(std::ostream &os, std::string name, const BenchStats &stats) {
+    name.erase(0, name.find_last_of("/\\") + 1); // remove the path (if any)
+    os << "| " << name << " | " << stats.elems << " | " << stats.reps
+       << " | " << stats.min << " | " << stats.median << " | " << stats.p99
+       << " | " << stats.ns_per_elem() << " | " << bench_maxrss() << " |\n";
+}
+
+// Markdown table (header and row) with the name of the running executable
+inline void
+bench_report(std::ostream &os, const std::string &name,
+             const BenchStats &stats) {
+    bench_header(os);
+    bench_row(os, name, stats);
+}
+
+#endif // CPP17_ITERATING_PROBLEMS_BENCH_HPP
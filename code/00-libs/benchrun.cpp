@@ -0,0 +1,79 @@
+// Runner for "make bench": executes a solution with stdin redirected from an
+// input file and stdout to an output file. stderr is discarded, unless -e
+// gives a file for it (e.g. to collect the rows of the bench harness).
+//
+//   benchrun [-e errput] runs input output command [args ...]
+//
+// Prints to stdout "wall_ms maxrss_kb exit_status", where wall_ms is the best
+// wall time of all runs and maxrss_kb the peak resident set size (POSIX only)
+#include <algorithm> // std::min, std::max
+#include <chrono> // std::chrono::xx
+#include <cstdlib> // std::atoi
+#include <cstring> // std::strcmp
+#include <iostream> // std::cout/cerr
+
+#include <fcntl.h> // open
+#include <sys/resource.h> // rusage
+#include <sys/wait.h> // wait4
+#include <unistd.h> // fork, dup2, execv
+
+// run the command once, returning the exit status and filling the usage
+auto
+run(char *argv[], const char *input, const char *output, const char *errput,
+    rusage &usage) {
+    const auto pid = fork();
+    if (pid == 0) { // child: redirect and replace the process image
+        const auto fdin = open(input, O_RDONLY);
+        const auto fdout = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        const auto fderr = open(errput, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fdin < 0 or fdout < 0 or fderr < 0)
+            _exit(126);
+
+        dup2(fdin, STDIN_FILENO);
+        dup2(fdout, STDOUT_FILENO);
+        dup2(fderr, STDERR_FILENO);
+        execv(argv[0], argv);
+        _exit(127); // only reached if execv failed
+    }
+    auto status = 0;
+    if (pid < 0 or wait4(pid, &status, 0, &usage) < 0)
+        return -1;
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+// Main
+int
+main(int argc, char *argv[]) {
+    auto errput = "/dev/null";
+    auto args = argv;
+    if (argc > 2 and std::strcmp(argv[1], "-e") == 0) {
+        errput = argv[2];
+        args += 2, argc -= 2;
+    }
+    if (argc < 5) {
+        std::cerr << "usage: " << argv[0]
+                  << " [-e errput] runs input output command [args ...]\n";
+        return 2;
+    }
+    auto runs = std::max(1, std::atoi(args[1]));
+    auto wall_ms = 0.0;
+    auto maxrss = 0L;
+    auto status = 0;
+    for (auto first = true; runs--; first = false) {
+        auto usage = rusage{};
+        const auto start = std::chrono::steady_clock::now();
+        status = run(args + 4, args[2], args[3], errput, usage);
+        const auto stop = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::
+            duration_cast<std::chrono::duration<double, std::milli>>(
+                stop - start).count();
+
+        wall_ms = first ? ms : std::min(wall_ms, ms); // best run
+        maxrss = std::max(maxrss, static_cast<long>(usage.ru_maxrss));
+        if (status)
+            break; // no point in repeating a failure
+    }
+    std::cout << wall_ms << ' ' << maxrss << ' ' << status << '\n';
+    return 0;
+}
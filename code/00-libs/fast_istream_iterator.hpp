@@ -0,0 +1,206 @@
+#ifndef CPP17_ITERATING_PROBLEMS_FAST_ISTREAM_ITERATOR_HPP
+#define CPP17_ITERATING_PROBLEMS_FAST_ISTREAM_ITERATOR_HPP
+
+#include <cerrno> // errno, EINTR
+#include <cstdint> // std::uint32_t
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <iostream> // std::istream, std::cin
+#include <iterator> // std::input_iterator_tag
+#include <map> // std::map
+#include <memory> // std::shared_ptr, std::weak_ptr
+#include <type_traits> // std::is_integral_v, std::make_unsigned_t
+#include <vector> // std::vector
+
+#if __has_include(<unistd.h>)
+#include <unistd.h> // read
+#define FAST_ISTREAM_HAS_READ
+#endif
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h> // _mm_xx
+#define FAST_ISTREAM_SSE2 // part of x86-64, no runtime check needed
+#endif
+
+// Buffered reader of an input stream. The buffer is refilled with read(2)
+// on file descriptor 0 for std::cin (no locale, no sync with stdio) and
+// with sgetn on the stream buffer otherwise. Nothing else may read from the
+// stream, because the characters in the buffer are no longer in the stream.
+class fast_istream_reader {
+    static constexpr auto BufSize = std::size_t{1} << 16;
+
+    std::istream *m_is;
+    std::vector<char> m_buf;
+    const char *m_pos = nullptr, *m_end = nullptr;
+
+    auto refill() {
+        auto n = std::ptrdiff_t{0};
+#ifdef FAST_ISTREAM_HAS_READ
+        if (m_is == &std::cin) {
+            do
+                n = ::read(0, m_buf.data(), m_buf.size());
+            while (n < 0 and errno == EINTR);
+        }
+        else
+#endif
+            n = m_is->rdbuf()->sgetn(m_buf.data(), m_buf.size());
+
+        m_pos = m_buf.data();
+        m_end = m_pos + (n > 0 ? n : 0);
+        return m_pos != m_end;
+    }
+
+    // next char as unsigned, -1 when the stream is exhausted
+    int get() {
+        if (m_pos == m_end and not refill())
+            return -1;
+        return static_cast<unsigned char>(*m_pos++);
+    }
+
+    static auto is_digit(int c) { return c >= '0' and c <= '9'; }
+
+public:
+    fast_istream_reader(std::istream &is) : m_is{&is}, m_buf(BufSize) {}
+
+    // Parses the next integer, skipping leading whitespace. No overflow
+    // check is made. Returns false (and leaves val untouched) if there is
+    // no integer, as the stream would set failbit.
+    template <typename T>
+    bool read(T &val) {
+        static_assert(std::is_integral_v<T>, "only integers are parsed");
+        auto c = get();
+        while (c >= 0 and c <= ' ')
+            c = get(); // whitespace
+
+        auto neg = false;
+        if (c == '-' or c == '+') {
+            neg = (c == '-');
+            c = get();
+        }
+        if (not is_digit(c))
+            return false;
+
+        auto u = std::make_unsigned_t<T>{}; // wraps around, no UB
+        for (; is_digit(c); c = get())
+            u = u * 10 + static_cast<std::make_unsigned_t<T>>(c - '0');
+
+        if (c >= 0)
+            --m_pos; // unget the delimiter, it is still in the buffer
+
+        val = static_cast<T>(neg ? ~u + 1 : u);
+        return true;
+    }
+
+    // Skips n tokens without parsing them, only looking for the whitespace
+    // in front of each one (16 chars at a time with SSE2). It leaves the
+    // buffer at the start of the next token. To be called after a read,
+    // with the token just read being no start. False if there were fewer.
+    bool skip(std::size_t n) {
+        auto prev = std::uint32_t{1}; // last char was part of a token
+        while (m_pos != m_end or refill()) {
+#ifdef FAST_ISTREAM_SSE2
+            const auto space = _mm_set1_epi8(' ');
+            for (; m_end - m_pos >= 16; m_pos += 16) {
+                const auto x =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(m_pos));
+                const auto ws = _mm_cmpeq_epi8(_mm_max_epu8(x, space), space);
+                const auto tok = ~_mm_movemask_epi8(ws) & 0xFFFFu;
+                auto starts = tok & ~((tok << 1) | prev);
+                prev = tok >> 15;
+                const auto count = static_cast<std::size_t>(
+                    __builtin_popcount(starts));
+                if (count > n) { // the next token starts in these 16
+                    for (; n; --n)
+                        starts &= starts - 1;
+                    m_pos += __builtin_ctz(starts);
+                    return true;
+                }
+                n -= count;
+            }
+#endif
+            for (; m_pos != m_end; ++m_pos) {
+                const auto tok = std::uint32_t{
+                    static_cast<unsigned char>(*m_pos) > ' '};
+                if (tok and not prev) {
+                    if (not n)
+                        return true;
+                    --n;
+                }
+                prev = tok;
+            }
+        }
+        return not n;
+    }
+
+    // One reader per stream, shared by all the iterators reading from it,
+    // alive while at least one of them is alive
+    static auto shared(std::istream &is) {
+        using Weak = std::weak_ptr<fast_istream_reader>;
+        static auto readers = std::map<const std::istream *, Weak>{};
+
+        auto &weak = readers[&is];
+        auto reader = weak.lock();
+        if (not reader)
+            weak = reader = std::make_shared<fast_istream_reader>(is);
+        return reader;
+    }
+};
+
+// Drop-in replacement for std::istream_iterator<T> for integer types. It is
+// also an input iterator and has the same semantics: a copy keeps the value
+// it holds and increments of any copy consume from the same stream. End of
+// stream (or a non-integer) makes it equal to the default constructed one.
+template <typename T>
+class fast_istream_iterator {
+    std::shared_ptr<fast_istream_reader> m_reader; // null at the end
+    T m_value{};
+
+    auto fetch() {
+        if (m_reader and not m_reader->read(m_value))
+            m_reader.reset(); // end of stream
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    fast_istream_iterator() = default; // end of stream
+    fast_istream_iterator(std::istream &is)
+        : m_reader{fast_istream_reader::shared(is)} { fetch(); }
+
+    reference operator*() const { return m_value; }
+    pointer operator->() const { return &m_value; }
+
+    auto &operator++() {
+        fetch();
+        return *this;
+    }
+    auto operator++(int) {
+        auto tmp = *this;
+        fetch();
+        return tmp;
+    }
+
+    // as n increments, but only the last token is parsed
+    auto &skip_tokens(std::size_t n) {
+        if (n and m_reader and m_reader->skip(n - 1))
+            fetch();
+        else if (n)
+            m_reader.reset(); // end of stream
+        return *this;
+    }
+
+    // equal if both at the end or both reading from the same stream
+    friend bool
+    operator==(const fast_istream_iterator &a, const fast_istream_iterator &b) {
+        return a.m_reader == b.m_reader;
+    }
+    friend bool
+    operator!=(const fast_istream_iterator &a, const fast_istream_iterator &b) {
+        return not (a == b);
+    }
+};
+
+#endif // CPP17_ITERATING_PROBLEMS_FAST_ISTREAM_ITERATOR_HPP
@@ -0,0 +1,234 @@
+#ifndef CPP17_ITERATING_PROBLEMS_FAST_OSTREAM_ITERATOR_HPP
+#define CPP17_ITERATING_PROBLEMS_FAST_OSTREAM_ITERATOR_HPP
+
+#include <algorithm> // std::copy
+#include <cerrno> // errno, EINTR
+#include <cmath> // std::fma, std::nearbyint, std::fabs, std::signbit
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdio> // std::snprintf, std::fflush
+#include <iostream> // std::ostream, std::cout
+#include <iterator> // std::output_iterator_tag
+#include <map> // std::map
+#include <memory> // std::shared_ptr, std::weak_ptr
+#include <string_view> // std::string_view
+#include <type_traits> // std::is_integral_v, std::is_floating_point_v ...
+#include <vector> // std::vector
+
+#if __has_include(<unistd.h>)
+#include <unistd.h> // write
+#define FAST_OSTREAM_HAS_WRITE
+#endif
+
+// Buffered writer to an output stream. Values are formatted by hand into the
+// buffer, which is flushed with write(2) on file descriptor 1 for std::cout
+// and with the stream's write otherwise. The buffer is flushed when full and
+// when the last iterator using the writer is gone.
+class fast_ostream_writer {
+    static constexpr auto BufSize = std::size_t{1} << 16;
+    static constexpr auto MaxChars = std::size_t{64}; // longest fast format
+
+    std::ostream *m_os;
+    std::vector<char> m_buf;
+    std::size_t m_len = 0;
+
+    auto flush() {
+        if (not m_len)
+            return;
+#ifdef FAST_OSTREAM_HAS_WRITE
+        if (m_os == &std::cout) {
+            std::fflush(stdout); // anything written before goes out first
+            for (auto p = m_buf.data(), end = p + m_len; p != end;) {
+                const auto n = ::write(1, p, end - p);
+                if (n < 0 and errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    break; // nowhere to write to
+                p += n;
+            }
+        }
+        else
+#endif
+            m_os->write(m_buf.data(), m_len);
+        m_len = 0;
+    }
+
+    // room for at least n chars at the end of the buffer
+    auto reserve(std::size_t n) {
+        if (m_len + n > m_buf.size())
+            flush();
+        if (n > m_buf.size())
+            m_buf.resize(n);
+        return m_buf.data() + m_len;
+    }
+
+    // digits of an unsigned value, written backwards from the end of buf
+    template <typename U>
+    static auto utoa(U u, char *end) {
+        do
+            *--end = static_cast<char>('0' + u % 10);
+        while (u /= 10);
+        return end;
+    }
+
+    template <typename T>
+    auto put_int(T val) {
+        using U = std::make_unsigned_t<T>;
+        auto u = static_cast<U>(val);
+        const auto neg = val < 0;
+        if (neg)
+            u = ~u + 1; // modulo arithmetic, valid for the minimum too
+
+        char tmp[MaxChars];
+        auto first = utoa(u, tmp + MaxChars);
+        if (neg)
+            *--first = '-';
+
+        put(std::string_view(first, tmp + MaxChars - first));
+    }
+
+    // Fixed notation by hand if value * 10^precision is exact and fits in
+    // 53 bits, as for the x.0/x.5 medians. printf rounding otherwise.
+    template <typename T>
+    auto put_float(T val) {
+        const auto flags = m_os->flags();
+        const auto prec = static_cast<int>(m_os->precision());
+        const auto fixed = (flags & std::ios::floatfield) == std::ios::fixed;
+        if (fixed and not (flags & std::ios::showpos) and prec < 16) {
+            auto pow10 = 1.0;
+            for (auto i = 0; i < prec; ++i)
+                pow10 *= 10;
+
+            const auto x = static_cast<double>(val);
+            const auto scaled = x * pow10;
+            if (std::fabs(scaled) < 9007199254740992.0 // 2^53
+                and std::fma(x, pow10, -scaled) == 0) { // no rounding made
+                const auto r = std::nearbyint(std::fabs(scaled)); // to even
+                auto u = static_cast<unsigned long long>(r);
+
+                char tmp[MaxChars];
+                auto first = tmp + MaxChars;
+                if (prec) {
+                    for (auto i = 0; i < prec; ++i, u /= 10)
+                        *--first = static_cast<char>('0' + u % 10);
+                    *--first = '.';
+                }
+                first = utoa(u, first);
+                if (std::signbit(x))
+                    *--first = '-'; // "-0.0" too, as printf does
+                put(std::string_view(first, tmp + MaxChars - first));
+                return;
+            }
+        }
+        // anything else goes through printf, which is what ostream uses, but
+        // for hexfloat (no precision) which is left to the stream
+        const auto hexfloat = std::ios::fixed | std::ios::scientific;
+        if ((flags & std::ios::floatfield) == hexfloat) {
+            flush();
+            *m_os << val;
+            return;
+        }
+        char fmt[8] = "%"; // flags, precision and conversion follow
+        auto f = fmt + 1;
+        if (flags & std::ios::showpos)
+            *f++ = '+';
+        *f++ = '.';
+        *f++ = '*'; // precision as argument
+        switch (flags & std::ios::floatfield) {
+            case std::ios::fixed: *f++ = 'f'; break;
+            case std::ios::scientific: *f++ = 'e'; break;
+            default: *f++ = 'g'; break;
+        }
+        *f = '\0';
+        char tmp[512];
+        const auto n = std::snprintf(tmp, sizeof(tmp), fmt, prec,
+                                     static_cast<double>(val));
+        if (n > 0 and static_cast<std::size_t>(n) < sizeof(tmp))
+            put(std::string_view(tmp, n));
+        else { // too long for the buffer, let the stream format it
+            flush();
+            *m_os << val;
+        }
+    }
+
+public:
+    fast_ostream_writer(std::ostream &os) : m_os{&os}, m_buf(BufSize) {
+        os.flush(); // keep the order with what the stream already has
+    }
+    ~fast_ostream_writer() { flush(); }
+
+    auto put(std::string_view sv) {
+        std::copy(sv.begin(), sv.end(), reserve(sv.size()));
+        m_len += sv.size();
+    }
+
+    template <typename T>
+    auto write(const T &val) {
+        if constexpr (std::is_same_v<T, bool>)
+            put_int(static_cast<int>(val)); // as the stream does by default
+        else if constexpr (std::is_integral_v<T>)
+            put_int(val);
+        else if constexpr (std::is_floating_point_v<T>)
+            put_float(val);
+        else
+            put(std::string_view(val)); // strings
+    }
+
+    // One writer per stream, shared by all the iterators writing to it,
+    // alive while at least one of them is alive
+    static auto shared(std::ostream &os) {
+        using Weak = std::weak_ptr<fast_ostream_writer>;
+        static auto writers = std::map<const std::ostream *, Weak>{};
+
+        auto &weak = writers[&os];
+        auto writer = weak.lock();
+        if (not writer)
+            weak = writer = std::make_shared<fast_ostream_writer>(os);
+        return writer;
+    }
+};
+
+// Drop-in replacement for std::ostream_iterator<T> for decimal integers,
+// floating point values (using the precision and floatfield/showpos flags of
+// the stream) and strings. With Infix the delimiter goes only between
+// elements, as done by os_iterator in hello-world-revolution-03.
+template <typename T, bool Infix = false>
+class fast_ostream_iterator {
+    std::shared_ptr<fast_ostream_writer> m_writer;
+    const char *m_delim; // not owned, as with std::ostream_iterator
+    bool m_dodelim = false; // infix: when to start separating
+
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    fast_ostream_iterator(std::ostream &os, const char *delim = nullptr)
+        : m_writer{fast_ostream_writer::shared(os)}, m_delim{delim} {}
+
+    // no-ops because only the assignment (= operator) does something
+    auto &operator *() { return *this; }
+    auto &operator ++() { return *this; } // ++prefix
+    auto &operator ++(int) { return *this; } // postfix++
+
+    auto &operator =(const T &outval) {
+        if constexpr (Infix) {
+            if (m_dodelim and m_delim) // separator before 2nd/later elements
+                m_writer->put(m_delim);
+            m_dodelim = true;
+            m_writer->write(outval);
+        } else {
+            m_writer->write(outval);
+            if (m_delim) // separator after each element
+                m_writer->put(m_delim);
+        }
+        return *this;
+    }
+};
+
+// delimiter only between elements, as os_iterator
+template <typename T>
+using fast_os_iterator = fast_ostream_iterator<T, true>;
+
+#endif // CPP17_ITERATING_PROBLEMS_FAST_OSTREAM_ITERATOR_HPP
@@ -0,0 +1,216 @@
+#ifndef CPP17_ITERATING_PROBLEMS_MMAP_INPUT_RANGE_HPP
+#define CPP17_ITERATING_PROBLEMS_MMAP_INPUT_RANGE_HPP
+
+#include <algorithm> // std::min
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <fstream> // std::ifstream
+#include <iostream> // std::cin
+#include <iterator> // std::random_access_iterator_tag, ...
+#include <type_traits> // std::is_integral_v, std::make_unsigned_t
+#include <vector> // std::vector
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // read, close
+#define MMAP_INPUT_HAS_MMAP
+#endif
+
+// The whole input (stdin or a file) as a random access range of integers.
+// Regular files are memory mapped, anything else (a pipe) is read at once.
+// A first pass only counts the tokens and records where each chunk of them
+// starts. The values of a chunk are parsed the first time one of them is
+// accessed, i.e. skipping over the input costs nothing. The input has to be
+// well formed: whitespace separated integers (anything else parses as 0).
+template <typename T>
+class mmap_input_range {
+    static_assert(std::is_integral_v<T>, "only integers are parsed");
+    static constexpr auto ChunkSize = std::size_t{4096}; // tokens
+
+    const char *m_data = nullptr; // input chars
+    std::size_t m_size = 0;
+    void *m_map = nullptr; // unmapped at destruction if not null
+    std::vector<char> m_buf; // input, if it could not be mapped
+
+    std::vector<std::size_t> m_chunks; // offset of 1st token of each chunk
+    std::size_t m_count = 0; // tokens
+    mutable std::vector<T> m_values; // parsed values
+    mutable std::vector<bool> m_parsed; // per chunk
+
+    // as unsigned, bytes from 0x80 up are not spaces (as in the iterators)
+    static auto is_space(char c) {
+        return static_cast<unsigned char>(c) <= ' ';
+    }
+
+    void load(const char *path) {
+#ifdef MMAP_INPUT_HAS_MMAP
+        const auto fd = path ? ::open(path, O_RDONLY) : 0;
+        if (fd < 0)
+            return; // empty range, as a failed stream
+        struct stat st{};
+        if (::fstat(fd, &st) == 0 and S_ISREG(st.st_mode) and st.st_size) {
+            m_size = static_cast<std::size_t>(st.st_size);
+            m_map = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (m_map == MAP_FAILED)
+                m_map = nullptr;
+        }
+        if (not m_map) { // pipe or terminal, read until exhausted
+            m_buf.resize(1 << 16);
+            auto len = std::size_t{0};
+            for (ssize_t n; (n = ::read(fd, m_buf.data() + len,
+                                        m_buf.size() - len)) > 0;) {
+                len += static_cast<std::size_t>(n);
+                if (len == m_buf.size())
+                    m_buf.resize(m_buf.size() * 2);
+            }
+            m_buf.resize(len);
+        }
+        if (path)
+            ::close(fd);
+#else
+        auto fin = std::ifstream{};
+        if (path)
+            fin.open(path, std::ios::binary);
+        auto &is = path ? static_cast<std::istream &>(fin) : std::cin;
+        m_buf.assign(std::istreambuf_iterator<char>{is}, {});
+#endif
+        if (not m_map) {
+            m_data = m_buf.data();
+            m_size = m_buf.size();
+        }
+        else
+            m_data = static_cast<const char *>(m_map);
+    }
+
+    // count the tokens, recording where chunks start
+    void scan() {
+        for (auto i = std::size_t{0}; i < m_size;) {
+            while (i < m_size and is_space(m_data[i]))
+                ++i;
+            if (i == m_size)
+                break;
+            if (m_count % ChunkSize == 0)
+                m_chunks.push_back(i);
+            ++m_count;
+            while (i < m_size and not is_space(m_data[i]))
+                ++i;
+        }
+        m_values.resize(m_count);
+        m_parsed.resize(m_chunks.size());
+    }
+
+    void parse(std::size_t chunk) const {
+        auto p = m_data + m_chunks[chunk];
+        const auto end = m_data + m_size;
+        const auto first = chunk * ChunkSize;
+        const auto last = std::min(m_count, first + ChunkSize);
+        for (auto i = first; i < last; ++i) {
+            while (is_space(*p))
+                ++p; // there is a token ahead, no need to check end
+            const auto neg = (*p == '-');
+            if (*p == '-' or *p == '+')
+                ++p;
+            auto u = std::make_unsigned_t<T>{}; // wraps around, no UB
+            for (; p != end and *p >= '0' and *p <= '9'; ++p)
+                u = u * 10 + static_cast<std::make_unsigned_t<T>>(*p - '0');
+            while (p != end and not is_space(*p))
+                ++p; // rest of a malformed token
+            m_values[i] = static_cast<T>(neg ? ~u + 1 : u);
+        }
+        m_parsed[chunk] = true;
+    }
+
+public:
+    // stdin if no path is given
+    mmap_input_range(const char *path = nullptr) {
+        load(path);
+        scan();
+    }
+    ~mmap_input_range() {
+#ifdef MMAP_INPUT_HAS_MMAP
+        if (m_map)
+            ::munmap(m_map, m_size);
+#endif
+    }
+    // iterators point into it, it cannot be copied around
+    mmap_input_range(const mmap_input_range &) = delete;
+    mmap_input_range &operator=(const mmap_input_range &) = delete;
+
+    auto size() const { return m_count; }
+
+    const T &operator[](std::size_t i) const {
+        const auto chunk = i / ChunkSize;
+        if (not m_parsed[chunk])
+            parse(chunk);
+        return m_values[i];
+    }
+
+    class const_iterator {
+        const mmap_input_range *m_range = nullptr;
+        std::ptrdiff_t m_idx = 0;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+        const_iterator(const mmap_input_range *range, difference_type idx)
+            : m_range{range}, m_idx{idx} {}
+
+        reference operator*() const { return (*m_range)[m_idx]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type n) const {
+            return (*m_range)[m_idx + n];
+        }
+
+        auto &operator++() { ++m_idx; return *this; }
+        auto &operator--() { --m_idx; return *this; }
+        auto operator++(int) { auto tmp = *this; ++m_idx; return tmp; }
+        auto operator--(int) { auto tmp = *this; --m_idx; return tmp; }
+        auto &operator+=(difference_type n) { m_idx += n; return *this; }
+        auto &operator-=(difference_type n) { m_idx -= n; return *this; }
+
+        friend auto operator+(const_iterator it, difference_type n) {
+            return it += n;
+        }
+        friend auto operator+(difference_type n, const_iterator it) {
+            return it += n;
+        }
+        friend auto operator-(const_iterator it, difference_type n) {
+            return it -= n;
+        }
+        friend auto operator-(const_iterator a, const_iterator b) {
+            return a.m_idx - b.m_idx;
+        }
+
+        friend bool operator==(const_iterator a, const_iterator b) {
+            return a.m_idx == b.m_idx;
+        }
+        friend bool operator!=(const_iterator a, const_iterator b) {
+            return a.m_idx != b.m_idx;
+        }
+        friend bool operator<(const_iterator a, const_iterator b) {
+            return a.m_idx < b.m_idx;
+        }
+        friend bool operator>(const_iterator a, const_iterator b) {
+            return b < a;
+        }
+        friend bool operator<=(const_iterator a, const_iterator b) {
+            return not (b < a);
+        }
+        friend bool operator>=(const_iterator a, const_iterator b) {
+            return not (a < b);
+        }
+    };
+
+    auto begin() const { return const_iterator{this, 0}; }
+    auto end() const {
+        return const_iterator{this, static_cast<std::ptrdiff_t>(m_count)};
+    }
+};
+
+#endif // CPP17_ITERATING_PROBLEMS_MMAP_INPUT_RANGE_HPP
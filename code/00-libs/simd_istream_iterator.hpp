@@ -0,0 +1,372 @@
+#ifndef CPP17_ITERATING_PROBLEMS_SIMD_ISTREAM_ITERATOR_HPP
+#define CPP17_ITERATING_PROBLEMS_SIMD_ISTREAM_ITERATOR_HPP
+
+#include <algorithm> // std::copy, std::fill
+#include <cerrno> // errno, EINTR
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint64_t, std::uint32_t
+#include <cstring> // std::memcpy
+#include <iostream> // std::istream, std::cin
+#include <iterator> // std::input_iterator_tag
+#include <map> // std::map
+#include <memory> // std::shared_ptr, std::weak_ptr
+#include <type_traits> // std::is_integral_v, std::make_unsigned_t
+#include <vector> // std::vector
+
+#if __has_include(<unistd.h>)
+#include <unistd.h> // read
+#define SIMD_ISTREAM_HAS_READ
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SIMD_ISTREAM_SWAR // digits8 needs little endian words
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h> // _mm_xx, _mm256_xx
+#define SIMD_ISTREAM_X86
+#endif
+
+namespace simd_istream_detail {
+
+// Bitmaps of whitespace (any char up to ' ') in 64 bytes: bit i is byte i
+struct WsScalar {
+    static std::uint64_t mask(const char *p) {
+        auto mask = std::uint64_t{0};
+        for (auto i = 0; i < 64; ++i)
+            if (static_cast<unsigned char>(p[i]) <= ' ')
+                mask |= std::uint64_t{1} << i;
+        return mask;
+    }
+};
+
+#ifdef SIMD_ISTREAM_X86
+// x <= ' ' (unsigned) is max(x, ' ') == ' '
+struct WsSse2 {
+    __attribute__((target("sse2"))) static std::uint64_t
+    mask(const char *p) {
+        const auto space = _mm_set1_epi8(' ');
+        auto mask = std::uint64_t{0};
+        for (auto i = 0; i < 4; ++i) {
+            const auto x = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(p + 16 * i));
+            const auto ws = _mm_cmpeq_epi8(_mm_max_epu8(x, space), space);
+            const auto bits = _mm_movemask_epi8(ws);
+            mask |= std::uint64_t{static_cast<std::uint16_t>(bits)} << (16 * i);
+        }
+        return mask;
+    }
+};
+
+struct WsAvx2 {
+    __attribute__((target("avx2"))) static std::uint64_t
+    mask(const char *p) {
+        const auto space = _mm256_set1_epi8(' ');
+        const auto lo =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        const auto hi =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32));
+        const auto wslo = _mm256_max_epu8(lo, space);
+        const auto wshi = _mm256_max_epu8(hi, space);
+        const auto lobits = static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(wslo, space)));
+        const auto hibits = static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(wshi, space)));
+        return std::uint64_t{lobits} | (std::uint64_t{hibits} << 32);
+    }
+};
+#endif
+
+enum class Isa { Scalar, Sse2, Avx2 };
+
+// best version supported by the running cpu
+inline Isa
+isa_dispatch() {
+#ifdef SIMD_ISTREAM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return Isa::Avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return Isa::Sse2;
+#endif
+    return Isa::Scalar;
+}
+
+// index of the lowest set bit, mask cannot be 0
+inline auto
+lowest_bit(std::uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(mask));
+#else
+    auto i = std::size_t{0};
+    for (; not (mask & 1); mask >>= 1)
+        ++i;
+    return i;
+#endif
+}
+
+// Calls ftoken(first, last) for each token in [0, end), end being a multiple
+// of 64. Returns where the token still open at the end starts, or end. The
+// edges of a block are collected first, to pair them up without branching.
+template <typename Ws, typename F>
+inline std::size_t
+find_tokens(const char *p, std::size_t end, F &ftoken) {
+    std::size_t edges_at[64 + 1] = {}; // a block plus a start carried over
+    auto n = std::size_t{0}, prev = std::uint64_t{0}; // prev: last was token
+    for (auto b = std::size_t{0}; b < end; b += 64) {
+        const auto tok = ~Ws::mask(p + b); // token chars
+        auto edges = tok ^ ((tok << 1) | prev); // starts and ends alternate
+        prev = tok >> 63;
+        for (; edges; edges &= edges - 1)
+            edges_at[n++] = b + lowest_bit(edges);
+        auto i = std::size_t{0};
+        for (; i + 1 < n; i += 2)
+            ftoken(edges_at[i], edges_at[i + 1]);
+        edges_at[0] = edges_at[i]; // a start without its end, if n is odd
+        n -= i;
+    }
+    return n ? edges_at[0] : end;
+}
+
+#ifdef SIMD_ISTREAM_X86
+// one copy of the loop per instruction set, with the bitmaps inlined
+template <typename F>
+__attribute__((target("avx2"), flatten)) std::size_t
+find_tokens_avx2(const char *p, std::size_t end, F &ftoken) {
+    return find_tokens<WsAvx2>(p, end, ftoken);
+}
+
+template <typename F>
+__attribute__((target("sse2"), flatten)) std::size_t
+find_tokens_sse2(const char *p, std::size_t end, F &ftoken) {
+    return find_tokens<WsSse2>(p, end, ftoken);
+}
+#endif
+
+template <typename F>
+std::size_t
+find_tokens(Isa isa, const char *p, std::size_t end, F &ftoken) {
+#ifdef SIMD_ISTREAM_X86
+    if (isa == Isa::Avx2)
+        return find_tokens_avx2(p, end, ftoken);
+    if (isa == Isa::Sse2)
+        return find_tokens_sse2(p, end, ftoken);
+#endif
+    return find_tokens<WsScalar>(p, end, ftoken);
+}
+
+// 1 to 8 digits at once (SWAR), with 8 chars readable from p. The digits
+// are moved to the top of a little endian word and combined in pairs.
+inline std::uint64_t
+digits8(const char *p, std::size_t len) {
+    auto v = std::uint64_t{};
+    std::memcpy(&v, p, sizeof(v));
+    v <<= 8 * (8 - len); // drop the chars after the digits
+    v = ((v & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8; // 10 * 2^8 + 1
+    v = ((v & 0x00FF00FF00FF00FF) * 6553601) >> 16; // 100 * 2^16 + 1
+    v = ((v & 0x0000FFFF0000FFFF) * 42949672960001) >> 32; // 10^4 * 2^32 + 1
+    return v;
+}
+
+} // namespace simd_istream_detail
+
+// Tokenizer of a stream of whitespace separated integers. The input is read
+// in large chunks (read(2) on fd 0 for std::cin, sgetn otherwise), the token
+// boundaries found 64 bytes at a time from the whitespace bitmaps and all
+// the tokens of a chunk converted (up to 8 digits at once) into a buffer of
+// values in one go. Tokens are not validated: non-digit chars are taken as
+// if they were digits.
+template <typename T>
+class simd_tokenizer {
+    static_assert(std::is_integral_v<T>, "only integers are parsed");
+    static constexpr auto BufSize = std::size_t{1} << 16; // multiple of 64
+    static constexpr auto Block = std::size_t{64};
+
+    std::istream *m_is;
+    std::vector<char> m_buf; // BufSize plus padding blocks
+    std::size_t m_len = 0; // chars in the buffer
+    bool m_eof = false;
+    std::vector<T> m_values; // tokens of the last chunk
+    std::size_t m_count = 0; // values in the buffer
+    std::size_t m_next = 0; // next value to deliver
+    simd_istream_detail::Isa m_isa;
+
+    // read until n chars or the end of the input
+    auto fill(char *p, std::size_t n) {
+        auto len = std::size_t{0};
+        while (len < n) {
+            auto got = std::ptrdiff_t{0};
+#ifdef SIMD_ISTREAM_HAS_READ
+            if (m_is == &std::cin) {
+                got = ::read(0, p + len, n - len);
+                if (got < 0 and errno == EINTR)
+                    continue;
+            }
+            else
+#endif
+                got = m_is->rdbuf()->sgetn(p + len, n - len);
+            if (got <= 0)
+                break;
+            len += static_cast<std::size_t>(got);
+        }
+        return len;
+    }
+
+    // a token, with at least 8 readable chars after it (see m_buf)
+    static auto parse(const char *p, std::size_t len) {
+        using U = std::make_unsigned_t<T>;
+        const auto neg = (*p == '-');
+        if (*p == '-' or *p == '+')
+            ++p, --len;
+        auto u = U{}; // wraps around, no UB
+#ifdef SIMD_ISTREAM_SWAR
+        using simd_istream_detail::digits8;
+        constexpr std::uint64_t Pow10[] = {
+            1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+        for (; len > 8; p += 8, len -= 8)
+            u = static_cast<U>(u * Pow10[8] + digits8(p, 8));
+        if (len)
+            u = static_cast<U>(u * Pow10[len] + digits8(p, len));
+#else
+        for (; len--; ++p)
+            u = u * 10 + static_cast<U>(*p - '0');
+#endif
+        return static_cast<T>(neg ? ~u + 1 : u);
+    }
+
+    // Tokenizes whole blocks of the buffer. A token still open at the end
+    // of the last block is moved to the front, to be completed by the next
+    // read. At the end of the input the padding closes the last token.
+    auto tokenize() {
+        m_count = m_next = 0;
+        const auto p = m_buf.data();
+        auto end = m_len - m_len % Block; // whole blocks
+        if (m_eof) { // pad with whitespace up to the next block
+            end = m_len + Block - m_len % Block;
+            std::fill(p + m_len, p + end, ' ');
+        }
+        auto ftoken = [this, p](std::size_t first, std::size_t last) {
+            m_values[m_count++] = parse(p + first, last - first);
+        };
+        using simd_istream_detail::find_tokens;
+        const auto open = find_tokens(m_isa, p, end, ftoken);
+        // a token filling the whole buffer (64 KB) is no number, dropped
+        const auto keep = (open != end and open) ? open : std::min(end, m_len);
+        std::copy(p + keep, p + m_len, p); // unprocessed chars to the front
+        m_len -= keep;
+    }
+
+    // read and tokenize until there are values, false at the end
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((noinline))
+#endif
+    bool refill() {
+        while (m_next == m_count) {
+            if (m_eof)
+                return false;
+            m_len += fill(m_buf.data() + m_len, BufSize - m_len);
+            m_eof = (m_len < BufSize);
+            tokenize();
+        }
+        return true;
+    }
+
+public:
+    simd_tokenizer(std::istream &is)
+        : m_is{&is}, m_buf(BufSize + 2 * Block),
+          m_values(BufSize / 2 + 1), // at most a token every 2 chars
+          m_isa{simd_istream_detail::isa_dispatch()} {}
+
+    // next value, false when the input is exhausted. Refilling is kept out
+    // of line, for the common path to be inlined in the iterator
+    bool read(T &val) {
+        if (m_next == m_count and not refill())
+            return false;
+        val = m_values[m_next++];
+        return true;
+    }
+
+    // skips n values, false if there were fewer. They are parsed anyway
+    bool skip(std::size_t n) {
+        while (n) {
+            if (m_next == m_count and not refill())
+                return false;
+            const auto step = std::min(n, m_count - m_next);
+            m_next += step;
+            n -= step;
+        }
+        return true;
+    }
+
+    // One tokenizer per stream, shared by all the iterators reading from it,
+    // alive while at least one of them is alive
+    static auto shared(std::istream &is) {
+        using Weak = std::weak_ptr<simd_tokenizer>;
+        static auto tokenizers = std::map<const std::istream *, Weak>{};
+
+        auto &weak = tokenizers[&is];
+        auto tokenizer = weak.lock();
+        if (not tokenizer)
+            weak = tokenizer = std::make_shared<simd_tokenizer>(is);
+        return tokenizer;
+    }
+};
+
+// Input iterator over the tokenizer, with the semantics of
+// std::istream_iterator (see fast_istream_iterator)
+template <typename T>
+class simd_istream_iterator {
+    std::shared_ptr<simd_tokenizer<T>> m_tokenizer; // null at the end
+    T m_value{};
+
+    auto fetch() {
+        if (m_tokenizer and not m_tokenizer->read(m_value))
+            m_tokenizer.reset(); // end of stream
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    simd_istream_iterator() = default; // end of stream
+    simd_istream_iterator(std::istream &is)
+        : m_tokenizer{simd_tokenizer<T>::shared(is)} { fetch(); }
+
+    reference operator*() const { return m_value; }
+    pointer operator->() const { return &m_value; }
+
+    auto &operator++() {
+        fetch();
+        return *this;
+    }
+    auto operator++(int) {
+        auto tmp = *this;
+        fetch();
+        return tmp;
+    }
+
+    // as n increments, without copying the values in between
+    auto &skip_tokens(std::size_t n) {
+        if (n and m_tokenizer and m_tokenizer->skip(n - 1))
+            fetch();
+        else if (n)
+            m_tokenizer.reset(); // end of stream
+        return *this;
+    }
+
+    // equal if both at the end or both reading from the same stream
+    friend bool
+    operator==(const simd_istream_iterator &a, const simd_istream_iterator &b) {
+        return a.m_tokenizer == b.m_tokenizer;
+    }
+    friend bool
+    operator!=(const simd_istream_iterator &a, const simd_istream_iterator &b) {
+        return not (a == b);
+    }
+};
+
+#endif // CPP17_ITERATING_PROBLEMS_SIMD_ISTREAM_ITERATOR_HPP
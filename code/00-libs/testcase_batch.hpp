@@ -0,0 +1,80 @@
+#ifndef CPP17_ITERATING_PROBLEMS_TESTCASE_BATCH_HPP
+#define CPP17_ITERATING_PROBLEMS_TESTCASE_BATCH_HPP
+
+#include <algorithm> // std::max, std::min
+#include <array> // std::array
+#include <cstddef> // std::size_t
+#include <thread> // std::thread
+#include <type_traits> // std::invoke_result_t
+#include <vector> // std::vector
+
+// All the testcases of an input, parsed up front. Each testcase has a
+// header of NParams values and a body whose size is given by fsize(params).
+// The bodies are stored one after the other in a single arena, with the
+// offset of each one: no allocation per testcase and no resync of the
+// input iterator (it is never copied). Reading stops at the end of input.
+template <typename T, std::size_t NParams>
+class testcase_batch {
+    using Params = std::array<T, NParams>;
+
+    std::vector<T> m_arena; // bodies of all testcases
+    std::vector<std::size_t> m_offsets{0}; // start of each body, plus end
+    std::vector<Params> m_params; // header of each testcase
+
+public:
+    template <typename I, typename F>
+    testcase_batch(I first, I last, F fsize) {
+        while (first != last) {
+            auto &params = m_params.emplace_back();
+            for (auto &param : params)
+                param = (first != last) ? *first++ : T{};
+            auto size = static_cast<std::size_t>(fsize(params));
+            for (; size and first != last; --size, ++first)
+                m_arena.push_back(*first);
+            m_offsets.push_back(m_arena.size());
+        }
+    }
+
+    auto size() const { return m_params.size(); }
+    const auto &params(std::size_t i) const { return m_params[i]; }
+    // the body can be modified in place (e.g. partitioned) by a solver
+    auto begin(std::size_t i) { return m_arena.begin() + m_offsets[i]; }
+    auto end(std::size_t i) { return m_arena.begin() + m_offsets[i + 1]; }
+};
+
+// Solves the testcases with fsolve(params, first, last) and writes the
+// results to out, in order. With nthreads > 1 the testcases are split in
+// consecutive ranges solved in parallel. The results are gathered and
+// written when all threads are done, out is only used by the caller thread.
+template <typename B, typename F, typename O>
+auto
+batch_solve(B &batch, F fsolve, O out, unsigned nthreads = 1) {
+    const auto size = batch.size();
+    auto fcase = [&batch, &fsolve](std::size_t i) {
+        return fsolve(batch.params(i), batch.begin(i), batch.end(i));
+    };
+    nthreads = std::max(1u, std::min<unsigned>(nthreads, size));
+    if (nthreads == 1) {
+        for (auto i = std::size_t{0}; i < size; ++i)
+            *out++ = fcase(i);
+        return out;
+    }
+    using R = std::invoke_result_t<decltype(fcase), std::size_t>;
+    auto results = std::vector<R>(size);
+    auto fchunk = [&results, &fcase, size, nthreads](unsigned t) {
+        const auto last = size * (t + 1) / nthreads;
+        for (auto i = size * t / nthreads; i < last; ++i)
+            results[i] = fcase(i);
+    };
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 1u; t < nthreads; ++t)
+        threads.emplace_back(fchunk, t);
+    fchunk(0); // own share
+    for (auto &thread : threads)
+        thread.join();
+    for (const auto &result : results)
+        *out++ = result;
+    return out;
+}
+
+#endif // CPP17_ITERATING_PROBLEMS_TESTCASE_BATCH_HPP
@@ -0,0 +1,106 @@
+#ifndef CPP17_ITERATING_PROBLEMS_WIDENING_SUM_HPP
+#define CPP17_ITERATING_PROBLEMS_WIDENING_SUM_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h> // _mm_xx, _mm256_xx
+#define WIDENING_SUM_X86
+#endif
+
+namespace widening_sum_detail {
+
+static_assert(sizeof(int) == 4, "the kernels widen 32 bit ints");
+
+using FSum = std::int64_t (*)(const int *, std::size_t);
+
+// 4 independent accumulators, not to wait on a single chain of additions
+inline std::int64_t
+sum_scalar(const int *p, std::size_t n) {
+    std::int64_t acc[4] = {};
+    auto i = std::size_t{0};
+    for (; i + 4 <= n; i += 4)
+        for (auto j = 0; j < 4; ++j)
+            acc[j] += p[i + j];
+    for (; i < n; ++i)
+        acc[0] += p[i];
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+#ifdef WIDENING_SUM_X86
+// rest of the lanes, once the vectors have been added up
+inline std::int64_t
+sum_lanes(const std::int64_t *lanes, std::size_t nlanes,
+          const int *p, std::size_t n) {
+    auto sum = std::int64_t{0};
+    for (auto i = std::size_t{0}; i < nlanes; ++i)
+        sum += lanes[i];
+    return sum + sum_scalar(p, n);
+}
+
+// 16 ints per round. SSE2 has no sign extension to 64 bits, the high
+// halves are made by interleaving each int with its sign (all 0 or all 1)
+__attribute__((target("sse2"))) inline std::int64_t
+sum_sse2(const int *p, std::size_t n) {
+    __m128i acc[4] = {};
+    auto i = std::size_t{0};
+    for (; i + 16 <= n; i += 16)
+        for (auto j = 0; j < 4; ++j) {
+            const auto x = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(p + i + 4 * j));
+            const auto sign = _mm_srai_epi32(x, 31);
+            acc[j] = _mm_add_epi64(acc[j], _mm_unpacklo_epi32(x, sign));
+            acc[j] = _mm_add_epi64(acc[j], _mm_unpackhi_epi32(x, sign));
+        }
+    const auto v = _mm_add_epi64(_mm_add_epi64(acc[0], acc[1]),
+                                 _mm_add_epi64(acc[2], acc[3]));
+    alignas(16) std::int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), v);
+    return sum_lanes(lanes, 2, p + i, n - i);
+}
+
+// 32 ints per round, sign extended to 64 bits straight from memory
+__attribute__((target("avx2"))) inline std::int64_t
+sum_avx2(const int *p, std::size_t n) {
+    __m256i acc[4] = {};
+    auto i = std::size_t{0};
+    for (; i + 32 <= n; i += 32)
+        for (auto j = 0; j < 8; ++j) {
+            const auto x = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(p + i + 4 * j));
+            acc[j % 4] = _mm256_add_epi64(acc[j % 4], _mm256_cvtepi32_epi64(x));
+        }
+    const auto v = _mm256_add_epi64(_mm256_add_epi64(acc[0], acc[1]),
+                                    _mm256_add_epi64(acc[2], acc[3]));
+    alignas(32) std::int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), v);
+    return sum_lanes(lanes, 4, p + i, n - i);
+}
+#endif
+
+// best version supported by the running cpu
+inline FSum
+sum_dispatch() {
+#ifdef WIDENING_SUM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return sum_avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return sum_sse2;
+#endif
+    return sum_scalar;
+}
+
+} // namespace widening_sum_detail
+
+// Sum of the ints in [first, last) plus init, added up as 64 bit integers
+// to not overflow: 2^32 ints fit even if they all are INT_MAX
+inline std::int64_t
+widening_sum(const int *first, const int *last, std::int64_t init = 0) {
+    static const auto fsum = widening_sum_detail::sum_dispatch(); // once
+    return init + fsum(first, static_cast<std::size_t>(last - first));
+}
+
+#endif // CPP17_ITERATING_PROBLEMS_WIDENING_SUM_HPP
@@ -0,0 +1,94 @@
+#include <cstdint> // std::int64_t
+#include <iostream> // std:cin/cout
+#include <iterator> // std::istream_iterator/ostream_iterator
+#include <numeric> // std::accumulate
+#include <string> // std::string, std::to_string
+#include <type_traits> // std::iterator_traits/enable_if/is_base_of
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run, bench_report
+#include "../00-libs/widening_sum.hpp" // widening_sum
+
+template <typename T, typename Tag>
+constexpr bool is_it_tag_v = std::is_base_of_v<
+    Tag, typename std::iterator_traits<T>::iterator_category>;
+
+template <typename I>
+constexpr bool is_input_v = is_it_tag_v<I, std::input_iterator_tag>;
+
+template <typename O>
+constexpr bool is_output_v = is_it_tag_v<O, std::output_iterator_tag>;
+
+template<typename I, typename O>
+constexpr bool io_iterators_v = is_input_v<I> && is_output_v<O>;
+
+template <typename T>
+using it_type = std::decay_t<decltype(*std::declval<T>())>;
+
+// elements next to each other in memory: pointers and vector iterators
+template <typename I, typename T = it_type<I>>
+constexpr bool is_contiguous_v = std::is_pointer_v<I>
+    || std::is_same_v<I, typename std::vector<T>::iterator>
+    || std::is_same_v<I, typename std::vector<T>::const_iterator>;
+
+// integers are added up as 64 bit integers, to not overflow
+template <typename T>
+using sum_type =
+    std::conditional_t<std::is_integral_v<T>, std::int64_t, T>;
+
+template<typename I, typename O>
+using S_Type = std::enable_if_t<io_iterators_v<I, O>, sum_type<it_type<I>>>;
+
+template <typename I, typename O>
+auto
+input_and_output(I first, I last, O out, S_Type<I, O> init = {}) {
+    if constexpr (is_contiguous_v<I> && std::is_same_v<it_type<I>, int>) {
+        const auto data = (first != last) ? &*first : nullptr;
+        *out++ = widening_sum(data, data + (last - first), init); // simd
+    }
+    else
+        *out++ = std::accumulate(first, last, init);
+}
+
+int
+main(int, char *argv[]) {
+    using prob_type = int;
+    input_and_output(
+        std::istream_iterator<prob_type>{std::cin},
+        std::istream_iterator<prob_type>{},
+        std::ostream_iterator<sum_type<prob_type>>{std::cout}
+    );
+
+#ifdef REPS
+    constexpr auto BenchSize = 100'000'000; // 10^8 ints, 400 MB
+    auto v = std::vector<prob_type>(BenchSize);
+    auto x = 0u;
+    for (auto &val : v) // large positive and negative values
+        val = static_cast<prob_type>(x += 2654435761u);
+
+    const auto name = std::string{argv[0]};
+    auto sums = std::vector<sum_type<prob_type>>{};
+    bench_header(std::cerr);
+    // the whole vector (memory bound) and a slice in cache, same total
+    for (auto slice : {BenchSize, 16'384}) {
+        const auto last = v.cbegin() + slice;
+        auto fsimd = [&]() {
+            sums.clear();
+            for (auto k = BenchSize / slice; k--;)
+                input_and_output(v.cbegin(), last, std::back_inserter(sums));
+            do_not_optimize(sums.back());
+        };
+        auto faccum = [&]() {
+            for (auto k = BenchSize / slice; k--;) // not hoisted by the sink
+                do_not_optimize(std::accumulate(v.cbegin(), last, 0LL));
+        };
+        const auto slicing = ":" + std::to_string(slice);
+        bench_row(std::cerr, name + slicing,
+                  bench_run(fsimd, REPS, v.size()));
+        bench_row(std::cerr, "std::accumulate" + slicing,
+                  bench_run(faccum, REPS, v.size()));
+        if (sums.back() != std::accumulate(v.cbegin(), last, std::int64_t{}))
+            std::cerr << "sum mismatch\n";
+    }
+#endif
+    return 0;
+}
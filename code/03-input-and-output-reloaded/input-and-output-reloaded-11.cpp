@@ -0,0 +1,138 @@
+#include <algorithm> // std::min, std::max
+#include <cstdint> // std::int64_t
+#include <iostream> // std:cin/cout
+#include <iterator> // std::istream_iterator/ostream_iterator
+#include <numeric> // std::accumulate
+#include <string> // std::string, std::to_string
+#include <thread> // std::thread
+#include <type_traits> // std::iterator_traits/enable_if/is_base_of
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run, bench_report
+#include "../00-libs/widening_sum.hpp" // widening_sum
+
+template <typename T, typename Tag>
+constexpr bool is_it_tag_v = std::is_base_of_v<
+    Tag, typename std::iterator_traits<T>::iterator_category>;
+
+template <typename I>
+constexpr bool is_input_v = is_it_tag_v<I, std::input_iterator_tag>;
+
+template <typename I>
+constexpr bool is_random_v = is_it_tag_v<I, std::random_access_iterator_tag>;
+
+template <typename O>
+constexpr bool is_output_v = is_it_tag_v<O, std::output_iterator_tag>;
+
+template<typename I, typename O>
+constexpr bool io_iterators_v = is_input_v<I> && is_output_v<O>;
+
+template <typename T>
+using it_type = std::decay_t<decltype(*std::declval<T>())>;
+
+// elements next to each other in memory: pointers and vector iterators
+template <typename I, typename T = it_type<I>>
+constexpr bool is_contiguous_v = std::is_pointer_v<I>
+    || std::is_same_v<I, typename std::vector<T>::iterator>
+    || std::is_same_v<I, typename std::vector<T>::const_iterator>;
+
+// integers are added up as 64 bit integers, to not overflow
+template <typename T>
+using sum_type =
+    std::conditional_t<std::is_integral_v<T>, std::int64_t, T>;
+
+template<typename I, typename O>
+using S_Type = std::enable_if_t<io_iterators_v<I, O>, sum_type<it_type<I>>>;
+
+// single threaded sum, simd for contiguous ints
+template <typename I, typename S>
+auto
+sequential_sum(I first, I last, S init) {
+    if constexpr (is_contiguous_v<I> && std::is_same_v<it_type<I>, int>) {
+        const auto data = (first != last) ? &*first : nullptr;
+        return widening_sum(data, data + (last - first), init);
+    }
+    else
+        return std::accumulate(first, last, init);
+}
+
+// Split the range in a chunk per thread and add up the partial sums. The
+// threads only write their result when done, no cache line ping-pong.
+// Floating point sums may differ in the last bits from a sequential sum.
+template <typename I, typename S>
+auto
+parallel_sum(I first, I last, S init, unsigned nthreads) {
+    const auto size = last - first;
+    auto partials = std::vector<S>(nthreads);
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 1u; t < nthreads; ++t) {
+        const auto cfirst = first + size * t / nthreads;
+        const auto clast = first + size * (t + 1) / nthreads;
+        threads.emplace_back([&partials, t, cfirst, clast]() {
+            partials[t] = sequential_sum(cfirst, clast, S{});
+        });
+    }
+    partials[0] = sequential_sum(first, first + size / nthreads, S{}); // own
+    for (auto &thread : threads)
+        thread.join();
+    return std::accumulate(partials.begin(), partials.end(), init);
+}
+
+// threads for a range, each of them with enough elements to pay off
+template <typename I>
+auto
+sum_threads(I first, I last) {
+    constexpr auto MinChunk = 1 << 20; // elements per thread
+    const auto hw = std::max(1u, std::thread::hardware_concurrency());
+    const auto chunks = static_cast<unsigned>((last - first) / MinChunk);
+    return std::max(1u, std::min(hw, chunks));
+}
+
+template <typename I, typename O>
+auto
+input_and_output(I first, I last, O out, S_Type<I, O> init = {}) {
+    if constexpr (is_random_v<I>) {
+        const auto nthreads = sum_threads(first, last);
+        if (nthreads > 1)
+            *out++ = parallel_sum(first, last, init, nthreads);
+        else
+            *out++ = sequential_sum(first, last, init);
+    }
+    else
+        *out++ = std::accumulate(first, last, init);
+}
+
+int
+main(int, char *argv[]) {
+    using prob_type = int;
+    input_and_output(
+        std::istream_iterator<prob_type>{std::cin},
+        std::istream_iterator<prob_type>{},
+        std::ostream_iterator<sum_type<prob_type>>{std::cout}
+    );
+
+#ifdef REPS
+    constexpr auto BenchSize = 100'000'000; // 10^8 ints, 400 MB
+    auto v = std::vector<prob_type>(BenchSize);
+    auto x = 0u;
+    for (auto &val : v) // large positive and negative values
+        val = static_cast<prob_type>(x += 2654435761u);
+
+    const auto name = std::string{argv[0]};
+    const auto expected = std::accumulate(v.cbegin(), v.cend(), 0LL);
+    const auto hw = std::max(1u, std::thread::hardware_concurrency());
+    bench_header(std::cerr);
+    for (auto nthreads = 1u, done = 0u; done != hw; nthreads *= 2) {
+        done = nthreads = std::min(nthreads, hw); // powers of 2 and hw
+        auto sum = sum_type<prob_type>{};
+        auto fbench = [&]() {
+            sum = parallel_sum(v.cbegin(), v.cend(), 0LL, nthreads);
+            do_not_optimize(sum);
+        };
+        const auto stats = bench_run(fbench, REPS, v.size());
+        bench_row(std::cerr, name + ":" + std::to_string(nthreads), stats);
+        if (sum != expected)
+            std::cerr << "sum mismatch\n";
+    }
+#endif
+    return 0;
+}
@@ -5,6 +5,8 @@
 #include <numeric> // std::accumulate
 #include <vector> // std::vector
 #include <type_traits> // std::enable_if, std::is_integral, std::void_t
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
 
 // SFINAE to check for It being an Input iterator and T and integer-like
 template <typename T, typename Tag>
@@ -114,9 +116,14 @@ minus_energy(I first, FMove fmove, FEnergy fenergy) {
 int
 main(int, char *[]) {
     constexpr auto e = 100; // starting energy level
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<int>{std::cout, "\n"}; // write(2)
+#else
     auto in = std::istream_iterator<int>{std::cin}; // input iterator
-    auto in_last = std::istream_iterator<int>{}; // input iterator end
     auto out = std::ostream_iterator<int>{std::cout, "\n"}; // output iterator
+#endif
+    auto in_last = decltype(in){}; // input iterator end
     for(; in != in_last; in++) { // resync "in" after copy_n operation
         auto n = *in++, k = *in++; // input parameters
         auto fenergy = [](auto acc, auto x) { return acc - (1 + (x * 2)); };
@@ -4,6 +4,8 @@
 #include <iterator> // std::istream/ostream_iterator, std::back_inserter
 #include <vector> // std::vector
 #include <type_traits> // std::void_t, std::enable_if ...
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
 
 // get iterator type
 template <typename I>
@@ -17,12 +19,22 @@ constexpr bool is_it_tag_v =
 template <typename I>
 constexpr bool is_input_v = is_it_tag_v<I, std::input_iterator_tag>;
 
-// check if iterator is std::istream_iterator
+// check if iterator is std::istream_iterator (or the fast version)
 template <template <typename> class B, typename I>
 constexpr bool is_base_of_iter_v = std::is_base_of_v<B<it_type<I>>, I>;
 
 template <typename I>
-constexpr bool is_istream_iter_v = is_base_of_iter_v<std::istream_iterator, I>;
+constexpr bool is_istream_iter_v =
+    is_base_of_iter_v<std::istream_iterator, I> or
+    is_base_of_iter_v<fast_istream_iterator, I>;
+
+// check if the iterator can skip elements without parsing them
+template <typename I, typename = void>
+constexpr bool has_skip_tokens_v = false;
+
+template <typename I>
+constexpr bool has_skip_tokens_v<I,
+    std::void_t<decltype(std::declval<I &>().skip_tokens(1))>> = true;
 
 // check function invocation and return type
 template<typename I, typename F>
@@ -33,26 +45,37 @@ constexpr bool is_fnk =
 template<typename I, typename F>
 using enable_if_iter_fnk = std::enable_if_t<is_input_v<I> and is_fnk<I, F>>;
 
-// custom count algorithm
+// custom count algorithm. As std::copy_n, "first" is incremented n - 1
+// times, the caller moves past the last element
 template <typename I, typename F, typename = enable_if_iter_fnk<I, F>>
 auto
 count_n_until_k_if(I first, int n, int k, F fnk) {
     auto count = 0;
-    for (; n-- and count != k; ++first)
+    for (; n > 0 and count != k; --n) {
         count += fnk(*first);
-
-    if constexpr (is_istream_iter_v<I>)
-        for(; n >= 0; --n, ++first); // consume "n" elements from istream_iter
-
+        if (n > 1) // not past the last element
+            ++first;
+    }
+    if constexpr (is_istream_iter_v<I>) { // consume "n" elements from istream
+        if constexpr (has_skip_tokens_v<I>)
+            first.skip_tokens(n > 1 ? n - 1 : 0); // no parsing
+        else
+            for(; n > 1; --n, ++first);
+    }
     return count;
 }
 
 // Main
 int
 main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<std::string>{std::cout, "\n"}; // write(2)
+#else
     auto in = std::istream_iterator<int>{std::cin}; // input iterator
-    auto in_last = std::istream_iterator<int>{}; // input iterator end
     auto out = std::ostream_iterator<std::string>{std::cout, "\n"}; // out iter
+#endif
+    auto in_last = decltype(in){}; // input iterator end
     constexpr auto canceled = std::array{"NO", "YES"};
     auto fearly = [](const auto &x) { return x <= 0; };
     [[maybe_unused]] auto t = *in++; // number of testcases (unused)
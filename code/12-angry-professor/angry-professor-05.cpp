@@ -0,0 +1,57 @@
+#include <array> // std::array
+#include <iostream> // std::cout
+#include <iterator> // std::ostream_iterator
+#include <string> // std::string
+#include <type_traits> // std::void_t, std::enable_if ...
+#include "../00-libs/mmap_input_range.hpp" // mmap_input_range
+
+// get iterator type
+template <typename I>
+using it_type = typename std::iterator_traits<I>::value_type;
+
+// check if iterator is input iterator
+template <typename T, typename Tag>
+constexpr bool is_it_tag_v =
+    std::is_base_of_v<Tag, typename std::iterator_traits<T>::iterator_category>;
+
+template <typename I>
+constexpr bool is_input_v = is_it_tag_v<I, std::input_iterator_tag>;
+
+// check function invocation and return type
+template<typename I, typename F>
+constexpr bool is_fnk =
+    std::is_same_v<bool, std::invoke_result_t<F, it_type<I>>>;
+
+// enabling check for custom count algorithm
+template<typename I, typename F>
+using enable_if_iter_fnk = std::enable_if_t<is_input_v<I> and is_fnk<I, F>>;
+
+// custom count algorithm, the caller skips the "n" elements if needed
+template <typename I, typename F, typename = enable_if_iter_fnk<I, F>>
+auto
+count_n_until_k_if(I first, int n, int k, F fnk) {
+    auto count = 0;
+    for (; n-- and count != k; ++first)
+        count += fnk(*first);
+
+    return count;
+}
+
+// Main
+int
+main(int argc, char *argv[]) {
+    // whole input mapped, an optional path can be given instead of stdin
+    const auto input = mmap_input_range<int>{argc > 1 ? argv[1] : nullptr};
+    auto in = input.begin(); // random access iterator
+    auto out = std::ostream_iterator<std::string>{std::cout, "\n"}; // out iter
+    constexpr auto canceled = std::array{"NO", "YES"};
+    auto fearly = [](const auto &x) { return x <= 0; };
+    [[maybe_unused]] auto t = *in++; // number of testcases (unused)
+    while (in != input.end()) {
+        const auto n = *in++, k = *in++; // students and threshold
+        const auto students = count_n_until_k_if(in, n, k, fearly);
+        *out++ = canceled[students < k];
+        in += n; // skip the testcase, no need to consume (or parse) it all
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <array> // std::array
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <string> // std::string
+#include <thread> // std::thread::hardware_concurrency
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+#include "../00-libs/testcase_batch.hpp" // testcase_batch, batch_solve
+
+template <typename I, typename F>
+auto
+count_n_until_k_if(I first, int n, int k, F fnk) {
+    auto count = 0;
+    for (; n-- and count != k; ++first)
+        count += fnk(*first);
+
+    return count;
+}
+
+// Main
+int
+main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<std::string>{std::cout, "\n"}; // write(2)
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<std::string>{std::cout, "\n"}; // out iter
+#endif
+    auto in_last = decltype(in){}; // input iterator end
+    constexpr auto canceled = std::array{"NO", "YES"};
+    auto fearly = [](const auto &x) { return x <= 0; };
+    [[maybe_unused]] auto t = *in++; // number of testcases (unused)
+    auto fsize = [](const auto &params) { return params[0]; }; // n students
+    auto cases = testcase_batch<int, 2>{in, in_last, fsize}; // one arena
+    auto fsolve = [&](const auto &params, auto first, auto) {
+        const auto [n, k] = params; // students and threshold
+        const auto students = count_n_until_k_if(first, n, k, fearly);
+        return canceled[students < k];
+    };
+    auto nthreads = 1u;
+#ifdef CASEPARALLEL
+    nthreads = std::thread::hardware_concurrency(); // ordered output anyway
+#endif
+    batch_solve(cases, fsolve, out, nthreads);
+    return 0;
+}
@@ -4,6 +4,8 @@
 #include <iterator> // std::istream/ostream_iterator
 #include <vector> // std::vector
 #include <type_traits> // std::void_t, std::enable_if ...
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
 
 // get container value type
 template <typename C>
@@ -103,9 +105,14 @@ filter_inserter(C &c, const F &fearly) {
 // Main
 int
 main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<std::string>{std::cout, "\n"}; // write(2)
+#else
     auto in = std::istream_iterator<int>{std::cin}; // input iterator
-    auto in_last = std::istream_iterator<int>{}; // input iterator end
     auto out = std::ostream_iterator<std::string>{std::cout, "\n"}; // out iter
+#endif
+    auto in_last = decltype(in){}; // input iterator end
     constexpr auto canceled = std::array{"NO", "YES"};
     const auto fearly = [](const auto &x) { return x <= 0; };
     [[maybe_unused]] auto t = *in++; // number of testcases (unused)
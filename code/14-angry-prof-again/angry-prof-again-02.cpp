@@ -5,6 +5,8 @@
 #include <iterator> // std::istream/ostream_iterator, std::back_inserter
 #include <vector> // std::vector
 #include <type_traits> // std::void_t, std::enable_if ...
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
 
 // get iterator value_type
 template <typename T>
@@ -67,9 +69,14 @@ n_of(I first, I last, ssize_t n, const F &f, bool at_least = false) {
 // Main
 int
 main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<std::string>{std::cout, "\n"}; // write(2)
+#else
     auto in = std::istream_iterator<int>{std::cin}; // input iterator
-    auto in_last = std::istream_iterator<int>{}; // input iterator end
     auto out = std::ostream_iterator<std::string>{std::cout, "\n"}; // out iter
+#endif
+    auto in_last = decltype(in){}; // input iterator end
     constexpr auto canceled = std::array{"NO", "YES"};
     const auto fearly = [](const auto &x) { return x <= 0; };
     [[maybe_unused]] auto t = *in++; // number of testcases (unused)
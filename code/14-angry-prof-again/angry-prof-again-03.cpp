@@ -0,0 +1,173 @@
+#include <array> // std::array
+#include <algorithm> // std::copy_n, std::partition
+#include <cmath> // std::abs
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator, std::back_inserter
+#include <string> // std::string
+#include <vector> // std::vector
+#include <type_traits> // std::void_t, std::enable_if ...
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h> // _mm_xx
+#define FIND_N_SSE2 // part of x86-64, no runtime check needed
+#endif
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+
+// get iterator value_type
+template <typename T>
+using it_type = typename std::iterator_traits<T>::value_type;
+
+// get iterator difference type
+template <typename T>
+using it_category = typename std::iterator_traits<T>::iterator_category;
+
+template <typename T>
+using it_difftype = typename std::iterator_traits<T>::difference_type;
+
+// Check if an iterator is a class/subclass of a given tag
+template <typename T, typename Tag>
+constexpr bool is_it_tag_v = std::is_base_of_v<Tag, it_category<T>>;
+
+template <typename I>
+constexpr bool is_input_it_v = is_it_tag_v<I, std::input_iterator_tag>;
+
+template <typename I>
+constexpr bool is_random_it_v = is_it_tag_v<I, std::random_access_iterator_tag>;
+
+// check function invocation and return type convertibility to bool
+template<typename I, typename F>
+constexpr bool is_f_v =
+    std::is_convertible_v<std::invoke_result_t<F, it_type<I>>, bool>;
+
+// check if input iterator and function can be called and delivers as expected
+template<typename I, typename F>
+using enable_if_n_of =
+    std::enable_if_t<(is_input_it_v<I> or is_random_it_v<I>) and is_f_v<I, F>>;
+
+// comparison predicates the simd path can recognize, unlike lambdas
+template <typename T>
+struct le {
+    T value;
+    constexpr bool operator()(const T &x) const { return x <= value; }
+};
+
+template <typename T>
+struct gt {
+    T value;
+    constexpr bool operator()(const T &x) const { return x > value; }
+};
+
+template <typename F, template <typename> class P>
+constexpr bool is_pred_v = std::is_same_v<F, P<int>>;
+
+// elements next to each other in memory: pointers and vector iterators
+template <typename I, typename T = it_type<I>>
+constexpr bool is_contiguous_v = std::is_pointer_v<I>
+    or std::is_same_v<I, typename std::vector<T>::iterator>
+    or std::is_same_v<I, typename std::vector<T>::const_iterator>;
+
+template<typename I, typename F>
+constexpr bool is_simd_n_of_v = is_contiguous_v<I>
+    and std::is_same_v<it_type<I>, int>
+    and (is_pred_v<F, le> or is_pred_v<F, gt>);
+
+#ifdef FIND_N_SSE2
+// 16 ints compared at once, bit i of the mask set if p[i] > value
+inline auto
+gt_mask16(const int *p, __m128i value) {
+    auto mask = 0u;
+    for (auto i = 0; i < 4; ++i) {
+        const auto x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(p) + i);
+        const auto gt = _mm_castsi128_ps(_mm_cmpgt_epi32(x, value));
+        mask |= static_cast<unsigned>(_mm_movemask_ps(gt)) << (4 * i);
+    }
+    return mask;
+}
+#endif
+
+// find_n_if (at least) for contiguous ints and a recognized predicate. The
+// matches of 16 elements are counted at once, with the bits of the nth one
+// only looked up in the 16 where the count reaches n (n > 0)
+template<typename I, typename F>
+auto
+find_n_if_simd(I first, I last, ssize_t n, const F &f) {
+    auto p = &*first, end = p + (last - first);
+#ifdef FIND_N_SSE2
+    const auto value = _mm_set1_epi32(f.value);
+    for (; end - p >= 16; p += 16) {
+        auto mask = gt_mask16(p, value);
+        if constexpr (is_pred_v<F, le>)
+            mask = ~mask & 0xFFFFu;
+        const auto count = __builtin_popcount(mask);
+        if (count >= n) { // nth found, clear the bits of the previous ones
+            while (--n)
+                mask &= mask - 1;
+            return first + ((p - &*first) + __builtin_ctz(mask));
+        }
+        n -= count;
+    }
+#endif
+    for (; p != end; ++p)
+        if (f(*p) and not --n)
+            return first + (p - &*first);
+    return last;
+}
+
+// find_n_if implementation: the nth element for which f is true, last if
+// there are fewer or, if not at_least, more of them
+template<typename I, typename F, typename = enable_if_n_of<I, F>>
+auto
+find_n_if(I first, I last, ssize_t n, const F &f, bool at_least = false) {
+    if constexpr (is_simd_n_of_v<I, F>)
+        if (at_least and n > 0 and first != last)
+            return find_n_if_simd(first, last, n, f);
+
+    it_difftype<I> dist;
+    if constexpr (is_random_it_v<I>)
+        dist = std::abs(std::distance(first, last));
+
+    auto nth = first; // stays if n is 0 from the start
+    for(; n >= at_least and first != last; ++first) {
+        if constexpr (is_random_it_v<I>)
+            if ((unsigned) dist-- < n)
+                break;
+
+        if (f(*first) and not --n)
+            nth = first; // keep going to see if there are more (not at_least)
+    }
+    // The loop may have been interrupted early. If n is not 0, either not
+    // enough items were found or too many (at least if fase) => return last
+    return n ? last : nth;
+}
+
+// n_of implementation
+template<typename I, typename F, typename = enable_if_n_of<I, F>>
+auto
+n_of(I first, I last, ssize_t n, const F &f, bool at_least = false) {
+    return find_n_if(first, last, n, f, at_least) != last;
+}
+
+// Main
+int
+main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<std::string>{std::cout, "\n"}; // write(2)
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<std::string>{std::cout, "\n"}; // out iter
+#endif
+    auto in_last = decltype(in){}; // input iterator end
+    constexpr auto canceled = std::array{"NO", "YES"};
+    const auto fearly = le<int>{0}; // x <= 0, known to the simd path
+    [[maybe_unused]] auto t = *in++; // number of testcases (unused)
+    for(; in != in_last; ++in) { // resync "in" after copy_n operation
+        const auto n = *in++, k = *in++; // students and threshold
+        auto c = std::vector<int>{}; // storage
+        std::copy_n(in, n, std::back_inserter(c)); // copy input
+        const auto early_students = n_of(c.begin(), c.end(), k, fearly, true);
+        *out++ = canceled[not early_students];
+    }
+    return 0;
+}
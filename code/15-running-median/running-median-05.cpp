@@ -0,0 +1,157 @@
+#include <cstdint> // std::uint32_t
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator
+#include <vector> // std::vector
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+
+#if defined(CASEPBDS) && __has_include(<ext/pb_ds/assoc_container.hpp>)
+#include <ext/pb_ds/assoc_container.hpp> // __gnu_pbds::tree
+#include <ext/pb_ds/tree_policy.hpp> // __gnu_pbds::tree_order_statistics_xx
+#include <functional> // std::less
+#include <utility> // std::pair
+
+// Same interface over the GNU policy based data structures. Keys are made
+// unique with a serial number, because the tree does not allow repetitions
+template <typename T>
+class OrderStatTree {
+    using Key = std::pair<T, std::size_t>;
+    __gnu_pbds::tree<
+        Key, __gnu_pbds::null_type, std::less<Key>, __gnu_pbds::rb_tree_tag,
+        __gnu_pbds::tree_order_statistics_node_update> m_tree;
+
+public:
+    OrderStatTree(std::size_t = 0) {}
+
+    auto size() const { return m_tree.size(); }
+    auto insert(const T &data) { m_tree.insert({data, m_tree.size()}); }
+    const auto &kth(std::size_t i) const {
+        return m_tree.find_by_order(i)->first;
+    }
+};
+#else
+// Treap (binary search tree balanced by random heap priorities) in which each
+// node also stores the size of its subtree. That is enough to find the k-th
+// key by descending the tree: O(log n), where std::next(multiset) is O(n)
+template <typename T>
+class OrderStatTree {
+    using Index = std::uint32_t;
+    static constexpr auto NullIndex = Index{}; // slot 0 is null, count 0
+
+    // structure of arrays: the same slot in each array describes a node
+    std::vector<T> m_keys{T{}};
+    std::vector<Index> m_left{NullIndex}, m_right{NullIndex};
+    std::vector<Index> m_count{0}; // nodes in the subtree, including itself
+    std::vector<std::uint32_t> m_prio{0}; // max-heap ordered priorities
+    Index m_root = NullIndex;
+    std::uint32_t m_seed = 2463534242; // xorshift32, reproducible runs
+
+    auto priority() {
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 17;
+        m_seed ^= m_seed << 5;
+        return m_seed;
+    }
+
+    auto create(const T &data) {
+        m_keys.push_back(data); // new node goes to the end of the arrays
+        m_left.push_back(NullIndex);
+        m_right.push_back(NullIndex);
+        m_count.push_back(1);
+        m_prio.push_back(priority());
+        return static_cast<Index>(m_keys.size() - 1);
+    }
+
+    auto update(Index node) {
+        m_count[node] = 1 + m_count[m_left[node]] + m_count[m_right[node]];
+    }
+
+    // keys not greater than data go to left, the rest to right. Repeated keys
+    // end up before the new one, as when descending in insert (and multiset)
+    void split(Index node, const T &data, Index &left, Index &right) {
+        if (node == NullIndex) {
+            left = right = NullIndex;
+            return;
+        }
+        if (not (data < m_keys[node])) {
+            split(m_right[node], data, m_right[node], right);
+            left = node;
+        } else {
+            split(m_left[node], data, left, m_left[node]);
+            right = node;
+        }
+        update(node);
+    }
+
+    // the new node goes down until its priority is higher than the current
+    Index insert(Index node, Index fresh) {
+        if (node == NullIndex)
+            return fresh;
+
+        if (m_prio[fresh] > m_prio[node]) { // fresh takes the place of node
+            split(node, m_keys[fresh], m_left[fresh], m_right[fresh]);
+            update(fresh);
+            return fresh;
+        }
+        auto &child = m_keys[fresh] < m_keys[node] ? m_left : m_right;
+        child[node] = insert(child[node], fresh);
+        update(node);
+        return node;
+    }
+
+public:
+    OrderStatTree(std::size_t hint = 0) {
+        m_keys.reserve(hint + 1); // account for the null slot
+        m_left.reserve(hint + 1);
+        m_right.reserve(hint + 1);
+        m_count.reserve(hint + 1);
+        m_prio.reserve(hint + 1);
+    }
+
+    auto size() const { return static_cast<std::size_t>(m_count[m_root]); }
+    auto insert(const T &data) {
+        const auto fresh = create(data); // push_back may move the arrays
+        m_root = insert(m_root, fresh);
+    }
+
+    // i-th key in sort order (0 based), i must be lower than size()
+    const auto &kth(std::size_t i) const {
+        auto node = m_root;
+        for (auto left = m_count[m_left[node]]; i != left;) {
+            if (i < left)
+                node = m_left[node];
+            else {
+                i -= left + 1; // skip left side and node
+                node = m_right[node];
+            }
+            left = m_count[m_left[node]];
+        }
+        return m_keys[node];
+    }
+};
+#endif
+
+// Main
+int
+main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<double>{std::cout, "\n"}; // write(2)
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+#endif
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+    auto t = *in++; // number of elements
+    auto s = OrderStatTree<int>(t); // drop-in for the multiset, plus kth
+    while (t--) {
+        s.insert(*in++); // add to the tree
+        auto left = (s.size() - 1) / 2; // pos of left val
+        auto outval = static_cast<double>(s.kth(left)); // O(log n)
+        if (not (s.size() % 2)) // median is avg of 2 values if size is even
+            outval = (outval + s.kth(left + 1)) / 2;
+        *out++ = outval;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator, std::istreambuf_iterator
+#include <set> // std::multiset
+#include <streambuf> // std::streambuf
+#include <string> // std::string
+#include "../00-libs/bench.hpp" // bench_run, do_not_optimize
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/simd_istream_iterator.hpp" // simd_istream_iterator
+
+// stream buffer reading straight from a string, no copy made
+struct StringBuf : std::streambuf {
+    StringBuf(const std::string &s) {
+        auto p = const_cast<char *>(s.data()); // only read
+        setg(p, p, p + s.size());
+    }
+};
+
+// parsing throughput of an input iterator over the text, in MB/s
+template <typename I>
+auto
+parse_bench(const char *name, const std::string &text, int reps) {
+    auto fbench = [&text]() {
+        auto buf = StringBuf{text};
+        auto is = std::istream{&buf};
+        auto sum = 0LL;
+        for (auto in = I{is}; in != I{}; ++in)
+            sum += *in;
+        do_not_optimize(sum);
+    };
+    const auto stats = bench_run(fbench, reps, text.size());
+    const auto mb = text.size() / 1e6;
+    std::cerr << "| " << name << " | " << mb << " | " << stats.reps << " | "
+              << stats.median << " | " << mb / stats.median << " |\n";
+}
+
+// Main
+int
+main(int, char *[]) {
+    // the whole input in memory, to parse it again for the benchmark
+    const auto text =
+        std::string{std::istreambuf_iterator<char>{std::cin}, {}};
+    auto buf = StringBuf{text};
+    auto is = std::istream{&buf};
+
+    auto in = simd_istream_iterator<int>{is}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+    auto s = std::multiset<int>{}; // allow repeated keys
+    auto rmed = s.end(); // running median iterator
+    for(auto t = *in++, odd = 1, val = 0, rval = 0; t--; odd = not odd) {
+        s.insert(val = *in++); // add to multi-set and store in "val"
+        rmed = (s.size() == 1) ? s.begin() // 1st value, no previous median
+            : (val >= rval) ? std::next(rmed, odd) : std::prev(rmed, not odd);
+        auto outval = static_cast<double>(rval = *rmed); // rval for next round
+        if (not odd) // median is avg of 2 values if size is even
+            outval = (outval + static_cast<double>(*std::next(rmed))) / 2;
+        *out++ = outval;
+    }
+
+#ifdef REPS // parsing throughput, only when benchmarking
+    std::cerr << "| parser | MB | reps | median (s) | MB/s |\n"
+              << "|---|---:|---:|---:|---:|\n";
+    parse_bench<std::istream_iterator<int>>("istream", text, REPS);
+    parse_bench<fast_istream_iterator<int>>("fast_istream", text, REPS);
+    parse_bench<simd_istream_iterator<int>>("simd_istream", text, REPS);
+#endif
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include <algorithm> // std::upper_bound, std::copy_backward, std::max
+#include <array> // std::array
+#include <cmath> // std::abs
+#include <cstddef> // std::size_t
+#include <fstream> // std::ifstream
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator, std::next/prev
+#include <set> // std::multiset
+#include "../00-libs/bench.hpp" // bench_maxrss
+
+// The multiset running median of solution 03, wrapped up. The first value
+// is special cased: in 03 rval starts at 0 and rmed at end(), so with a
+// negative first value rmed stays at end() and is dereferenced (for the
+// input "1 / -3" it prints 1.0 instead of -3.0)
+template <typename T>
+class ExactMedian {
+    std::multiset<T> m_set; // allow repeated keys
+    typename std::multiset<T>::iterator m_med = m_set.end(); // median iter
+    bool m_odd = true; // odd number of values after the next push
+
+public:
+    auto push(const T &val) {
+        const auto rval = m_set.empty() ? val : *m_med; // previous median
+        m_set.insert(val);
+        m_med = m_set.size() == 1 ? m_set.begin()
+            : (val >= rval) ? std::next(m_med, m_odd)
+                            : std::prev(m_med, not m_odd);
+        auto outval = static_cast<double>(*m_med);
+        if (not m_odd) // median is avg of 2 values if size is even
+            outval = (outval + static_cast<double>(*std::next(m_med))) / 2;
+        m_odd = not m_odd;
+        return outval;
+    }
+};
+
+// P-square estimator of a quantile (Jain and Chlamtac, 1985): 5 markers
+// whose heights follow the minimum, the p/2, p, (1+p)/2 quantiles and the
+// maximum. Their positions drift to the desired ones, the heights being
+// adjusted with a piecewise parabolic (else linear) prediction. O(1) memory
+// and time per value. The first values, up to 5, are exact.
+class P2Quantile {
+    double m_p; // the quantile
+    std::array<double, 5> m_q{}; // marker heights
+    std::array<double, 5> m_n{}; // marker positions (1 based)
+    std::array<double, 5> m_np{}; // desired positions
+    std::array<double, 5> m_dn{}; // increments of the desired positions
+    std::size_t m_count = 0;
+
+    auto parabolic(std::size_t i, double d) const {
+        const auto &q = m_q, &n = m_n;
+        return q[i] + d / (n[i + 1] - n[i - 1]) *
+            ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+             (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+    }
+
+    auto linear(std::size_t i, int d) const {
+        const auto j = i + d;
+        return m_q[i] + d * (m_q[j] - m_q[i]) / (m_n[j] - m_n[i]);
+    }
+
+    // exact quantile of the first values (as the problem for p = 0.5)
+    auto exact() const {
+        const auto h = m_p * (m_count - 1);
+        const auto lo = static_cast<std::size_t>(h);
+        if (lo + 1 == m_count)
+            return m_q[lo];
+        return m_q[lo] + (m_q[lo + 1] - m_q[lo]) * (h - lo);
+    }
+
+public:
+    P2Quantile(double p = 0.5)
+        : m_p{p}, m_n{1, 2, 3, 4, 5},
+          m_np{1, 1 + 2 * p, 1 + 4 * p, 3 + 2 * p, 5},
+          m_dn{0, p / 2, p, (1 + p) / 2, 1} {}
+
+    // estimate after adding x
+    auto push(double x) {
+        if (m_count < 5) { // keep them sorted, they are the initial heights
+            const auto last = m_q.begin() + m_count++;
+            const auto pos = std::upper_bound(m_q.begin(), last, x);
+            std::copy_backward(pos, last, last + 1);
+            *pos = x;
+            return exact();
+        }
+        ++m_count;
+        auto k = std::size_t{0}; // cell of x, extremes updated if needed
+        if (x < m_q[0])
+            m_q[0] = x;
+        else if (x >= m_q[4]) {
+            m_q[4] = std::max(m_q[4], x);
+            k = 3;
+        }
+        else
+            while (x >= m_q[k + 1])
+                ++k;
+
+        for (auto i = k + 1; i < 5; ++i)
+            m_n[i] += 1;
+        for (auto i = 0; i < 5; ++i)
+            m_np[i] += m_dn[i];
+
+        for (auto i = std::size_t{1}; i < 4; ++i) { // inner markers
+            const auto d = m_np[i] - m_n[i];
+            if ((d >= 1 and m_n[i + 1] - m_n[i] > 1) or
+                (d <= -1 and m_n[i - 1] - m_n[i] < -1)) {
+                const auto sd = d > 0 ? 1 : -1;
+                const auto qp = parabolic(i, sd);
+                m_q[i] = (m_q[i - 1] < qp and qp < m_q[i + 1])
+                    ? qp : linear(i, sd);
+                m_n[i] += sd;
+            }
+        }
+        return m_q[2];
+    }
+};
+
+// Error of the values against the ones of an expected output
+struct AccuracyReport {
+    std::size_t count = 0, exact = 0; // exact: within the 1 decimal output
+    double sum_abs = 0, max_abs = 0, sum_rel = 0;
+
+    auto add(double value, double expected) {
+        const auto err = std::abs(value - expected);
+        ++count;
+        exact += (err < 0.05);
+        sum_abs += err;
+        max_abs = std::max(max_abs, err);
+        sum_rel += expected ? err / std::abs(expected) : 0;
+    }
+
+    friend auto &operator <<(std::ostream &os, const AccuracyReport &r) {
+        const auto n = r.count ? static_cast<double>(r.count) : 1;
+        return os << "| values | exact | mean abs err | max abs err"
+                  << " | mean rel err | maxrss (KB) |\n"
+                  << "|---:|---:|---:|---:|---:|---:|\n"
+                  << "| " << r.count << " | " << r.exact << " | "
+                  << r.sum_abs / n << " | " << r.max_abs << " | "
+                  << r.sum_rel / n << " | " << bench_maxrss() << " |\n";
+    }
+};
+
+// Main
+int
+main(int argc, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+
+    // optional expected output, e.g. running-median.output01, to report
+    // the accuracy of the (approximate) medians
+    auto fexpected = std::ifstream{};
+    if (argc > 1)
+        fexpected.open(argv[1]);
+    auto expected = std::istream_iterator<double>{fexpected};
+    const auto expected_last = std::istream_iterator<double>{};
+    auto report = AccuracyReport{};
+
+#ifdef CASEAPPROX
+    auto median = P2Quantile{0.5}; // 5 markers, whatever the length
+#else
+    auto median = ExactMedian<int>{}; // the whole stream is kept
+#endif
+    for(auto t = *in++; t--;) {
+        const auto outval = median.push(*in++);
+        *out++ = outval;
+        if (expected != expected_last)
+            report.add(outval, *expected++);
+    }
+    if (report.count)
+        std::cerr << report;
+    return 0;
+}
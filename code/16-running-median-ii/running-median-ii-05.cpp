@@ -0,0 +1,117 @@
+#include <algorithm> // std::sort, std::unique, std::lower_bound
+#include <cstdint> // std::uint32_t
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator, std::back_inserter
+#include <vector> // std::vector
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+
+// Fenwick tree (binary indexed tree) counting the values seen per bucket.
+// Adding a value and finding the k-th one are both O(log buckets), with all
+// the counts in a single contiguous array.
+template <typename T = int>
+class FenwickMedian {
+    std::vector<T> m_keys; // bucket -> value, empty if the value is the bucket
+    std::vector<std::uint32_t> m_tree; // 1-based, slot 0 unused
+    std::size_t m_step = 1; // highest power of 2 not above the bucket count
+    std::size_t m_size = 0; // values added
+
+    auto init(std::size_t buckets) {
+        m_tree.assign(buckets + 1, 0);
+        while ((m_step << 1) <= buckets)
+            m_step <<= 1;
+    }
+
+    auto bucket(const T &val) const {
+        if (m_keys.empty())
+            return static_cast<std::size_t>(val);
+
+        return static_cast<std::size_t>(
+            std::lower_bound(m_keys.begin(), m_keys.end(), val) -
+            m_keys.begin());
+    }
+
+    auto value(std::size_t bucket) const {
+        return m_keys.empty() ? static_cast<T>(bucket) : m_keys[bucket];
+    }
+
+public:
+    // bounded domain: values from 0 to maxval are directly the buckets
+    FenwickMedian(T maxval) { init(static_cast<std::size_t>(maxval) + 1); }
+
+    // coordinate compression: the buckets are the distinct values in range
+    template <typename I>
+    FenwickMedian(I first, I last) : m_keys(first, last) {
+        std::sort(m_keys.begin(), m_keys.end());
+        m_keys.erase(std::unique(m_keys.begin(), m_keys.end()), m_keys.end());
+        init(m_keys.size());
+    }
+
+    auto size() const { return m_size; }
+
+    // false (nothing added) if val has no bucket: out of 0 ... maxval with
+    // the bounded domain (a negative one wraps around) or above all values
+    auto insert(const T &val) {
+        const auto n = m_tree.size();
+        const auto b = bucket(val);
+        if (b >= n - 1)
+            return false;
+        for (auto i = b + 1; i < n; i += i & (~i + 1)) // lowbit
+            ++m_tree[i];
+        ++m_size;
+        return true;
+    }
+
+    // i-th value in sort order (0 based), i must be lower than size(). The
+    // largest prefix holding at most i values is built bit by bit, the k-th
+    // value is in the next bucket
+    auto kth(std::size_t i) const {
+        auto pos = std::size_t{0};
+        for (auto step = m_step; step; step >>= 1) {
+            const auto next = pos + step;
+            if (next < m_tree.size() and m_tree[next] <= i) {
+                pos = next;
+                i -= m_tree[next];
+            }
+        }
+        return value(pos); // 1-based pos + 1 is 0-based bucket pos
+    }
+};
+
+// Main
+int
+main(int, char *[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<double>{std::cout, "\n"}; // write(2)
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+#endif
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+    auto t = *in++; // number of elements
+#ifdef CASEDIRECT
+    constexpr auto MaxVal = 100000; // problem constraint: 0 <= a[i] <= 10^5
+    auto fm = FenwickMedian<int>(MaxVal); // streaming, no need to store
+    while (t--) {
+        auto val = *in++;
+#else
+    auto v = std::vector<int>{};
+    v.reserve(t);
+    std::copy_n(in, t, std::back_inserter(v)); // the whole stream up front
+    auto fm = FenwickMedian<int>(v.begin(), v.end()); // compress the values
+    for(auto val : v) {
+#endif
+        if (not fm.insert(val)) { // only if out of the bounded domain
+            std::cerr << "value out of range: " << val << "\n";
+            return 1;
+        }
+        auto left = (fm.size() - 1) / 2; // pos of left val
+        auto outval = static_cast<double>(fm.kth(left)); // O(log buckets)
+        if (not (fm.size() % 2)) // median is avg of 2 values if size is even
+            outval = (outval + fm.kth(left + 1)) / 2;
+        *out++ = outval;
+    }
+    return 0;
+}
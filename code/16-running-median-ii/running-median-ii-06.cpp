@@ -0,0 +1,110 @@
+#include <algorithm> // std::copy_n
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator, std::next/prev
+#include <set> // std::multiset
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/header/row, BenchSink
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+
+// Median of a window: the lower half of the values is kept in one multiset
+// and the upper half in another. Unlike a heap, a multiset can remove any
+// value, i.e. the one leaving the window. The lower half holds the extra
+// value when the size is odd.
+template <typename T>
+class WindowMedian {
+    std::multiset<T> m_lo, m_hi;
+
+    const auto &lo_max() const { return *std::prev(m_lo.end()); }
+
+    // nodes are moved between the halves, not reallocated
+    auto rebalance() {
+        if (m_lo.size() > m_hi.size() + 1)
+            m_hi.insert(m_lo.extract(std::prev(m_lo.end())));
+        else if (m_hi.size() > m_lo.size())
+            m_lo.insert(m_hi.extract(m_hi.begin()));
+    }
+
+public:
+    auto size() const { return m_lo.size() + m_hi.size(); }
+
+    auto insert(const T &val) {
+        if (m_lo.empty() or not (lo_max() < val))
+            m_lo.insert(val);
+        else
+            m_hi.insert(val);
+        rebalance();
+    }
+
+    // val must be in the window. If not above the max of the lower half, it
+    // is in the lower half, because the upper half holds nothing lower
+    auto erase(const T &val) {
+        if (not (lo_max() < val))
+            m_lo.erase(m_lo.find(val));
+        else
+            m_hi.erase(m_hi.find(val));
+        rebalance();
+    }
+
+    auto median() const {
+        auto outval = static_cast<double>(lo_max());
+        if (m_lo.size() == m_hi.size()) // median is avg of 2 values if even
+            outval = (outval + static_cast<double>(*m_hi.begin())) / 2;
+        return outval;
+    }
+};
+
+// in has to be a multipass iterator: the values leaving the window are read
+// again through a 2nd iterator following the 1st one
+template <typename I, typename O>
+auto
+solution(I in, O out, std::size_t size, std::size_t window) {
+    auto wm = WindowMedian<int>{};
+    for (auto first = in; size--;) {
+        wm.insert(*in++);
+        if (wm.size() > window)
+            wm.erase(*first++); // only the last "window" values are kept
+        *out++ = wm.median();
+    }
+}
+
+// Main
+int
+main(int, char *argv[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<double>{std::cout, "\n"}; // write(2)
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+#endif
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+
+    auto t = static_cast<std::size_t>(*in++);
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); // vin is not invalidated
+
+    auto window = t; // the whole prefix, as in the other solutions
+#ifdef WINDOW
+    static_assert(WINDOW >= 1, "the window holds at least one value");
+    window = WINDOW; // "make window=W"
+#endif
+    solution(vin, out, t, window); // to match expected output
+
+#ifdef REPS // growing stream lengths, only when benchmarking
+    // the cost per element has to stay flat when a window is in use and
+    // grow with log(n) when the prefix is the window
+    auto lengths = std::vector<std::size_t>{}; // t/16, t/8, ..., t
+    for (auto n = t; n and lengths.size() < 5; n >>= 1)
+        lengths.insert(lengths.begin(), n);
+
+    bench_header(std::cerr);
+    for (auto n : lengths) {
+        auto fbench = [&]() { solution(vin, BenchSink{}, n, window); };
+        bench_row(std::cerr, argv[0], bench_run(fbench, REPS, n));
+    }
+#endif
+    return 0;
+}
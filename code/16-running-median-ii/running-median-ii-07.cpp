@@ -0,0 +1,145 @@
+#include <algorithm> // std::copy_n
+#include <cstddef> // std::size_t
+#include <functional> // std::greater
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator
+#include <queue> // std::priority_queue
+#include <string> // std::string
+#include <tuple> // std::tuple, std::get
+#include <variant> // std::variant, std::visit
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/header/row, BenchSink
+
+// Type Erasure Idiom for the Heap (as in solution 03)
+template<typename T>
+struct Heap {
+    virtual ~Heap() = default;
+
+    auto *get_basepointer() { return this; }
+
+    // abstract interface
+    virtual void push(const T &) = 0;
+    virtual T top() const = 0;
+    virtual void pop() = 0;
+    virtual size_t size() const = 0;
+};
+
+template<typename T, template <typename> typename Comp = std::less>
+struct MyHeap : Heap<T> {
+    using PrioQ = std::priority_queue<T, std::vector<T>, Comp<T>>;
+    PrioQ m_prioq;
+
+    void push(const T &x) override { m_prioq.push(x); }
+    T top() const override { return m_prioq.top(); }
+    void pop() override { m_prioq.pop(); }
+    size_t size() const override { return m_prioq.size(); }
+};
+
+// median after pushing x to ql, once its top has been moved over to qr
+template <typename HL, typename HR, typename T>
+auto
+push_median(HL &ql, HR &qr, const T &x) {
+    ql.push(x); // push to get it sorted
+    qr.push(ql.top()); // balance to other side moving top
+    ql.pop(); // complete move by removing the moved value
+    auto rmed = static_cast<double>(qr.top()); // side we really pushed to
+    if (ql.size() == qr.size()) // same size -- use other side too
+        rmed = (rmed + static_cast<double>(ql.top())) / 2;
+    return rmed;
+}
+
+// Solution 03: virtual calls through swapped base pointers
+template <typename I, typename O>
+auto
+solution_virtual(I first, std::size_t t, O out) {
+    auto ql = MyHeap<int>{}; // left heap (max at top)
+    auto qr = MyHeap<int, std::greater>{}; // right heap (min at top)
+    auto *qlp = ql.get_basepointer(), *qrp = qr.get_basepointer();
+    for(; t--; std::swap(qlp, qrp))
+        *out++ = push_median(*qlp, *qrp, *first++);
+}
+
+// Solution 04: std::visit over swapped variants
+template <typename I, typename O>
+auto
+solution_variant(I first, std::size_t t, O out) {
+    using LHeap = std::priority_queue<int>;
+    using RHeap = std::priority_queue<int, std::vector<int>, std::greater<int>>;
+    using VHeap = std::variant<LHeap, RHeap>;
+    auto vql = VHeap{LHeap{}}, vqr = VHeap{RHeap{}};
+    const auto visitor = [&first, &out](auto &&ql, auto &&qr) {
+        *out++ = push_median(ql, qr, *first++);
+    };
+    for(; t--; std::swap(vql, vqr))
+        std::visit(visitor, vql, vqr);
+}
+
+// Two heaps running median with static dispatch. The heap taking the new
+// value alternates and the roles are swapped by index, known at compile
+// time: no pointers to swap, no virtual calls, no visiting. All inlined.
+template <typename T,
+          typename LHeap = std::priority_queue<T>,
+          typename RHeap = std::priority_queue<T, std::vector<T>,
+                                               std::greater<T>>>
+class TwoHeapMedian {
+    std::tuple<LHeap, RHeap> m_heaps;
+    std::size_t m_size = 0;
+
+    template <std::size_t I>
+    auto push(const T &x) {
+        return push_median(std::get<I>(m_heaps), std::get<1 - I>(m_heaps), x);
+    }
+
+public:
+    // median after adding x, the left heap takes the even positions
+    auto push(const T &x) {
+        return (m_size++ % 2) ? push<1>(x) : push<0>(x);
+    }
+
+    // medians of the t values from first, two at a time to avoid the check
+    template <typename I, typename O>
+    auto run(I first, std::size_t t, O out) {
+        if (t and m_size % 2)
+            --t, *out++ = push(*first++);
+        for (; t >= 2; t -= 2, m_size += 2) {
+            *out++ = push<0>(*first++);
+            *out++ = push<1>(*first++);
+        }
+        if (t)
+            *out++ = push(*first++);
+        return out;
+    }
+};
+
+template <typename I, typename O>
+auto
+solution_static(I first, std::size_t t, O out) {
+    TwoHeapMedian<int>{}.run(first, t, out);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+
+    auto t = static_cast<std::size_t>(*in++);
+    auto v = std::vector<int>(t);
+    std::copy_n(in, t, v.begin());
+    solution_static(v.begin(), t, out); // to match expected output
+
+#ifdef REPS // the competing engines, only when benchmarking
+    t = bench_repeat(v, t, 10'000'000); // input repeated up to 10^7 values
+    auto fvirtual = [&]() { solution_virtual(v.begin(), t, BenchSink{}); };
+    auto fvariant = [&]() { solution_variant(v.begin(), t, BenchSink{}); };
+    auto fstatic = [&]() { solution_static(v.begin(), t, BenchSink{}); };
+    const auto name = std::string{argv[0]};
+    bench_header(std::cerr);
+    bench_row(std::cerr, name + ":virtual", bench_run(fvirtual, REPS, t));
+    bench_row(std::cerr, name + ":variant", bench_run(fvariant, REPS, t));
+    bench_row(std::cerr, name + ":static", bench_run(fstatic, REPS, t));
+#endif
+    return 0;
+}
@@ -0,0 +1,207 @@
+#include <algorithm> // std::copy_n
+#include <cstddef> // std::size_t
+#include <functional> // std::less, std::greater
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator
+#include <queue> // std::priority_queue
+#include <string> // std::string
+#include <tuple> // std::tuple, std::get
+#include <type_traits> // std::void_t
+#include <utility> // std::declval, std::move
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/header/row, BenchSink
+
+// Implicit d-ary heap with the interface of std::priority_queue, plus
+// reserve, replace_top and push_pop. The children of node i are at
+// D * i + 1 ... D * i + D: with D = 4 the tree is half as deep as a binary
+// one and the children of a node share a cache line (for ints).
+template <typename T, typename Comp = std::less<T>, std::size_t D = 4>
+class DaryHeap {
+    static_assert(D >= 2, "a heap needs at least 2 children per node");
+
+    std::vector<T> m_data;
+    Comp m_comp; // as in std::priority_queue: the top is the "largest"
+
+    auto sift_up(std::size_t i) {
+        auto x = std::move(m_data[i]);
+        while (i) {
+            const auto parent = (i - 1) / D;
+            if (not m_comp(m_data[parent], x))
+                break;
+            m_data[i] = std::move(m_data[parent]);
+            i = parent;
+        }
+        m_data[i] = std::move(x);
+    }
+
+    auto sift_down(std::size_t i) {
+        const auto size = m_data.size();
+        auto x = std::move(m_data[i]);
+        for (auto first = D * i + 1; first < size; first = D * i + 1) {
+            auto best = first; // "largest" child
+            const auto last = std::min(first + D, size);
+            for (auto c = first + 1; c < last; ++c)
+                if (m_comp(m_data[best], m_data[c]))
+                    best = c;
+            if (not m_comp(x, m_data[best]))
+                break;
+            m_data[i] = std::move(m_data[best]);
+            i = best;
+        }
+        m_data[i] = std::move(x);
+    }
+
+public:
+    auto reserve(std::size_t n) { m_data.reserve(n); }
+    auto size() const { return m_data.size(); }
+    auto empty() const { return m_data.empty(); }
+    const auto &top() const { return m_data.front(); }
+
+    auto push(const T &x) {
+        m_data.push_back(x);
+        sift_up(m_data.size() - 1);
+    }
+
+    auto pop() {
+        m_data.front() = std::move(m_data.back());
+        m_data.pop_back();
+        if (not m_data.empty())
+            sift_down(0);
+    }
+
+    // pop followed by push, with a single sift (not empty)
+    auto replace_top(const T &x) {
+        m_data.front() = x;
+        sift_down(0);
+    }
+
+    // push followed by pop, returning the popped value. If x would be the
+    // new top, it comes straight back and the heap is not touched.
+    auto push_pop(const T &x) {
+        if (m_data.empty() or not m_comp(x, m_data.front()))
+            return x;
+        auto top = std::move(m_data.front());
+        replace_top(x);
+        return top;
+    }
+};
+
+// check if the heap has push_pop and reserve (a DaryHeap)
+template <typename H, typename = void>
+constexpr bool has_push_pop_v = false;
+
+template <typename H>
+constexpr bool has_push_pop_v<H, std::void_t<decltype(
+    std::declval<H &>().push_pop(std::declval<const H &>().top()))>> = true;
+
+template <typename H, typename = void>
+constexpr bool has_reserve_v = false;
+
+template <typename H>
+constexpr bool has_reserve_v<H,
+    std::void_t<decltype(std::declval<H &>().reserve(0))>> = true;
+
+// median after pushing x to ql, once its top has been moved over to qr
+template <typename HL, typename HR, typename T>
+auto
+push_median(HL &ql, HR &qr, const T &x) {
+    if constexpr (has_push_pop_v<HL>)
+        qr.push(ql.push_pop(x)); // the balance step with a single sift
+    else {
+        ql.push(x); // push to get it sorted
+        qr.push(ql.top()); // balance to other side moving top
+        ql.pop(); // complete move by removing the moved value
+    }
+    auto rmed = static_cast<double>(qr.top()); // side we really pushed to
+    if (ql.size() == qr.size()) // same size -- use other side too
+        rmed = (rmed + static_cast<double>(ql.top())) / 2;
+    return rmed;
+}
+
+// Two heaps running median with static dispatch (see solution 07). With
+// the length of the stream known, the heaps get their storage up front.
+template <typename T,
+          typename LHeap = DaryHeap<T>,
+          typename RHeap = DaryHeap<T, std::greater<T>>>
+class TwoHeapMedian {
+    std::tuple<LHeap, RHeap> m_heaps;
+    std::size_t m_size = 0;
+
+    template <std::size_t I>
+    auto push(const T &x) {
+        return push_median(std::get<I>(m_heaps), std::get<1 - I>(m_heaps), x);
+    }
+
+public:
+    TwoHeapMedian() = default;
+    TwoHeapMedian(std::size_t t) { // expected number of values
+        if constexpr (has_reserve_v<LHeap>)
+            std::get<0>(m_heaps).reserve(t / 2 + 1);
+        if constexpr (has_reserve_v<RHeap>)
+            std::get<1>(m_heaps).reserve(t / 2 + 1);
+    }
+
+    // median after adding x, the left heap takes the even positions
+    auto push(const T &x) {
+        return (m_size++ % 2) ? push<1>(x) : push<0>(x);
+    }
+
+    // medians of the t values from first, two at a time to avoid the check
+    template <typename I, typename O>
+    auto run(I first, std::size_t t, O out) {
+        if (t and m_size % 2)
+            --t, *out++ = push(*first++);
+        for (; t >= 2; t -= 2, m_size += 2) {
+            *out++ = push<0>(*first++);
+            *out++ = push<1>(*first++);
+        }
+        if (t)
+            *out++ = push(*first++);
+        return out;
+    }
+};
+
+template <std::size_t D, typename I, typename O>
+auto
+solution(I first, std::size_t t, O out) {
+    using Median = TwoHeapMedian<int, DaryHeap<int, std::less<int>, D>,
+                                 DaryHeap<int, std::greater<int>, D>>;
+    Median{t}.run(first, t, out);
+}
+
+template <typename I, typename O>
+auto
+solution_prioq(I first, std::size_t t, O out) {
+    using LHeap = std::priority_queue<int>;
+    using RHeap = std::priority_queue<int, std::vector<int>, std::greater<int>>;
+    TwoHeapMedian<int, LHeap, RHeap>{t}.run(first, t, out);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+
+    auto t = static_cast<std::size_t>(*in++);
+    auto v = std::vector<int>(t);
+    std::copy_n(in, t, v.begin());
+    solution<4>(v.begin(), t, out); // to match expected output
+
+#ifdef REPS // the competing engines, only when benchmarking
+    t = bench_repeat(v, t, 10'000'000); // input repeated up to 10^7 values
+    auto fprioq = [&]() { solution_prioq(v.begin(), t, BenchSink{}); };
+    auto fdary2 = [&]() { solution<2>(v.begin(), t, BenchSink{}); };
+    auto fdary4 = [&]() { solution<4>(v.begin(), t, BenchSink{}); };
+    auto fdary8 = [&]() { solution<8>(v.begin(), t, BenchSink{}); };
+    const auto name = std::string{argv[0]};
+    bench_header(std::cerr);
+    bench_row(std::cerr, name + ":prioq", bench_run(fprioq, REPS, t));
+    bench_row(std::cerr, name + ":d2", bench_run(fdary2, REPS, t));
+    bench_row(std::cerr, name + ":d4", bench_run(fdary4, REPS, t));
+    bench_row(std::cerr, name + ":d8", bench_run(fdary8, REPS, t));
+#endif
+    return 0;
+}
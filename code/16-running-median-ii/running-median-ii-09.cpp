@@ -0,0 +1,217 @@
+#include <algorithm> // std::copy_n, std::sort, std::unique, std::lower_bound
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uintmax_t
+#include <functional> // std::greater
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator
+#include <queue> // std::priority_queue
+#include <ratio> // std::ratio
+#include <string> // std::string
+#include <tuple> // std::tuple, std::apply
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/header/row, BenchSink
+
+// rank (times the denominator) of quantile R among n values, to interpolate
+// between the values at rank h / den and h / den + 1 (numpy's default)
+template <typename R>
+constexpr auto
+quantile_rank(std::size_t n) {
+    static_assert(R::num >= 0 and R::num <= R::den, "quantile not in [0, 1]");
+    return static_cast<std::uintmax_t>(R::num) * (n - 1);
+}
+
+template <typename R>
+auto
+interpolate(double low, double high, std::uintmax_t h) {
+    if (const auto frac = h % R::den) // no interpolation if exact rank
+        low += (high - low) * static_cast<double>(frac) / R::den;
+    return low;
+}
+
+// The two heaps of the running median (solution 02) generalized to any
+// quantile R: the low heap holds the values up to the rank of R and the
+// high heap the rest. Each value moves at most once across the heaps, as
+// the rank grows at most by one with each value. R = 1/2 is the median.
+template <typename T, typename R = std::ratio<1, 2>>
+class QuantileHeaps {
+    std::priority_queue<T> m_low; // max at top
+    std::priority_queue<T, std::vector<T>, std::greater<T>> m_high; // min
+
+public:
+    auto size() const { return m_low.size() + m_high.size(); }
+
+    // quantile after adding x
+    auto push(const T &x) {
+        if (m_low.empty() or not (m_low.top() < x))
+            m_low.push(x);
+        else
+            m_high.push(x);
+
+        const auto h = quantile_rank<R>(size());
+        const auto lowsize = static_cast<std::size_t>(h / R::den) + 1;
+        if (m_low.size() > lowsize) { // balance moving one top across
+            m_high.push(m_low.top());
+            m_low.pop();
+        }
+        else if (m_low.size() < lowsize) {
+            m_low.push(m_high.top());
+            m_high.pop();
+        }
+        const auto high = m_high.empty() ? m_low.top() : m_high.top();
+        return interpolate<R>(m_low.top(), high, h);
+    }
+};
+
+// Several quantiles, each one with its own pair of heaps
+template <typename T, typename... Rs>
+class HeapsQuantiles {
+    std::tuple<QuantileHeaps<T, Rs>...> m_heaps;
+
+public:
+    template <typename O>
+    auto push(const T &x, O out) {
+        std::apply([&](auto &...qh) { ((*out++ = qh.push(x)), ...); }, m_heaps);
+        return out;
+    }
+};
+
+// Fenwick tree counting the values seen per bucket, the buckets being the
+// distinct values of the stream (as FenwickMedian in solution 05)
+template <typename T>
+class FenwickTree {
+    std::vector<T> m_keys; // bucket -> value
+    std::vector<std::uint32_t> m_tree; // 1-based, slot 0 unused
+    std::size_t m_step = 1; // highest power of 2 not above the bucket count
+    std::size_t m_size = 0; // values added
+
+public:
+    template <typename I>
+    FenwickTree(I first, I last) : m_keys(first, last) {
+        std::sort(m_keys.begin(), m_keys.end());
+        m_keys.erase(std::unique(m_keys.begin(), m_keys.end()), m_keys.end());
+        m_tree.assign(m_keys.size() + 1, 0);
+        while ((m_step << 1) <= m_keys.size())
+            m_step <<= 1;
+    }
+
+    auto size() const { return m_size; }
+
+    auto insert(const T &val) {
+        const auto n = m_tree.size();
+        const auto bucket =
+            std::lower_bound(m_keys.begin(), m_keys.end(), val) -
+            m_keys.begin();
+        for (auto i = static_cast<std::size_t>(bucket) + 1; i < n;
+             i += i & (~i + 1)) // lowbit
+            ++m_tree[i];
+        ++m_size;
+    }
+
+    // i-th value in sort order (0 based), i must be lower than size()
+    auto kth(std::size_t i) const {
+        auto pos = std::size_t{0};
+        for (auto step = m_step; step; step >>= 1) {
+            const auto next = pos + step;
+            if (next < m_tree.size() and m_tree[next] <= i) {
+                pos = next;
+                i -= m_tree[next];
+            }
+        }
+        return m_keys[pos];
+    }
+};
+
+// Several quantiles sharing a single order statistic structure: each value
+// is inserted once and each quantile costs one or two kth lookups
+template <typename T, typename... Rs>
+class MultiQuantile {
+    FenwickTree<T> m_tree;
+
+    template <typename R>
+    auto quantile() const {
+        const auto h = quantile_rank<R>(m_tree.size());
+        const auto rank = static_cast<std::size_t>(h / R::den);
+        const auto low = static_cast<double>(m_tree.kth(rank));
+        if (not (h % R::den))
+            return low;
+        return interpolate<R>(low, m_tree.kth(rank + 1), h);
+    }
+
+public:
+    // the values of the stream, to know the buckets
+    template <typename I>
+    MultiQuantile(I first, I last) : m_tree(first, last) {}
+
+    template <typename O>
+    auto push(const T &x, O out) {
+        m_tree.insert(x);
+        ((*out++ = quantile<Rs>()), ...);
+        return out;
+    }
+};
+
+template <typename Q, typename I, typename O>
+auto
+solution(Q &&quantiles, I first, std::size_t t, O out) {
+    while (t--)
+        out = quantiles.push(*first++, out);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+
+    auto t = static_cast<std::size_t>(*in++);
+    auto v = std::vector<int>(t);
+    std::copy_n(in, t, v.begin());
+    auto qmedian = QuantileHeaps<int>{}; // R = 1/2, the problem
+    for (auto val : v)
+        *out++ = qmedian.push(val); // to match expected output
+
+#ifdef REPS // the competing engines, only when benchmarking
+    t = bench_repeat(v, t, 1'000'000); // input repeated up to 10^6 values
+    using P10 = std::ratio<1, 10>;
+    using P25 = std::ratio<1, 4>;
+    using P50 = std::ratio<1, 2>;
+    using P75 = std::ratio<3, 4>;
+    using P90 = std::ratio<9, 10>;
+    using P95 = std::ratio<95, 100>;
+    using P99 = std::ratio<99, 100>;
+    using P999 = std::ratio<999, 1000>;
+    const auto first = v.begin(), last = v.begin() + t;
+    auto fheaps1 = [&]() {
+        solution(HeapsQuantiles<int, P50>{}, first, t, BenchSink{});
+    };
+    auto fheaps3 = [&]() {
+        solution(HeapsQuantiles<int, P50, P90, P99>{}, first, t, BenchSink{});
+    };
+    auto fheaps8 = [&]() {
+        using Q = HeapsQuantiles<int, P10, P25, P50, P75, P90, P95, P99, P999>;
+        solution(Q{}, first, t, BenchSink{});
+    };
+    auto fmulti1 = [&]() {
+        solution(MultiQuantile<int, P50>{first, last}, first, t, BenchSink{});
+    };
+    auto fmulti3 = [&]() {
+        using Q = MultiQuantile<int, P50, P90, P99>;
+        solution(Q{first, last}, first, t, BenchSink{});
+    };
+    auto fmulti8 = [&]() {
+        using Q = MultiQuantile<int, P10, P25, P50, P75, P90, P95, P99, P999>;
+        solution(Q{first, last}, first, t, BenchSink{});
+    };
+    const auto name = std::string{argv[0]};
+    bench_header(std::cerr);
+    bench_row(std::cerr, name + ":heaps-1", bench_run(fheaps1, REPS, t));
+    bench_row(std::cerr, name + ":heaps-3", bench_run(fheaps3, REPS, t));
+    bench_row(std::cerr, name + ":heaps-8", bench_run(fheaps8, REPS, t));
+    bench_row(std::cerr, name + ":fenwick-1", bench_run(fmulti1, REPS, t));
+    bench_row(std::cerr, name + ":fenwick-3", bench_run(fmulti3, REPS, t));
+    bench_row(std::cerr, name + ":fenwick-8", bench_run(fmulti8, REPS, t));
+#endif
+    return 0;
+}
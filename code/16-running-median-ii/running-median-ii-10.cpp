@@ -0,0 +1,129 @@
+#include <algorithm> // std::lower/upper_bound, std::partition_point, ...
+#include <cstddef> // std::size_t
+#include <functional> // std::less, std::greater
+#include <iostream> // std::cout/cin
+#include <iomanip> // std::setprecision, ...
+#include <iterator> // std::istream/ostream_iterator
+#include <string> // std::string
+#include <utility> // std::move
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/header/row, BenchSink
+
+// Sorted vector split in blocks of B to 2 * B values (a block is split in
+// two halves when full). An insert moves at most 2 * B values plus the
+// block starts after it, instead of half of the values as std::vector
+// insert does. Access by index is a binary search over the block starts.
+// Both are plain scans over contiguous memory, as with a single vector.
+template <typename T, typename Comp = std::less<T>, std::size_t B = 512>
+class BlockedSortedVector {
+    std::vector<std::vector<T>> m_blocks; // sorted, none empty
+    std::vector<std::size_t> m_starts; // index of the first value per block
+    std::size_t m_size = 0;
+    Comp m_comp;
+
+    auto split(std::size_t b) {
+        auto &block = m_blocks[b];
+        auto half = std::vector<T>(block.begin() + B, block.end());
+        half.reserve(2 * B);
+        block.resize(B);
+        m_blocks.insert(m_blocks.begin() + b + 1, std::move(half));
+        m_starts.insert(m_starts.begin() + b + 1, m_starts[b] + B);
+    }
+
+public:
+    auto size() const { return m_size; }
+    auto empty() const { return m_size == 0; }
+
+    // insert val before the first value not ordered before it (lower_bound)
+    auto insert(const T &val) {
+        if (m_blocks.empty()) {
+            m_blocks.emplace_back().reserve(2 * B);
+            m_starts.push_back(0);
+        }
+        // first block whose last value is not ordered before val, else last
+        const auto fbefore = [this, &val](const auto &block) {
+            return m_comp(block.back(), val);
+        };
+        auto it = std::partition_point(m_blocks.begin(), m_blocks.end() - 1,
+                                       fbefore);
+        const auto b = static_cast<std::size_t>(it - m_blocks.begin());
+        it->insert(std::lower_bound(it->begin(), it->end(), val, m_comp), val);
+        for (auto i = b + 1; i < m_starts.size(); ++i)
+            ++m_starts[i];
+        ++m_size;
+        if (it->size() == 2 * B)
+            split(b);
+    }
+
+    const auto &operator[](std::size_t i) const {
+        const auto b = static_cast<std::size_t>(
+            std::upper_bound(m_starts.begin(), m_starts.end(), i) -
+            m_starts.begin()) - 1;
+        return m_blocks[b][i - m_starts[b]];
+    }
+};
+
+// Insertion sort median of solution 01 with any sorted container V
+template <typename V, typename I, typename O>
+auto
+solution(V &&v, I first, std::size_t t, O out) {
+    for(auto odd = 1; t--; odd = not odd) {
+        v.insert(*first++);
+        auto left = (v.size() - 1) / 2;
+        auto outval = static_cast<double>(v[left]);
+        if (not odd) // median is avg of 2 values if size is even
+            outval = (outval + static_cast<double>(v[left + 1])) / 2;
+        *out++ = outval;
+    }
+}
+
+// Solution 01: a single std::vector, half of it moved per insert
+struct SortedVector {
+    std::vector<int> m_v;
+    constexpr static auto fgreater = std::greater<int>{};
+
+    auto size() const { return m_v.size(); }
+    auto operator[](std::size_t i) const { return m_v[i]; }
+    auto insert(int val) {
+        auto idx = std::lower_bound(m_v.begin(), m_v.end(), val, fgreater);
+        m_v.insert(idx, val); // insert val just before idx
+    }
+};
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<double>{std::cout, "\n"}; // out iter
+    std::cout << std::fixed << std::setprecision(1); // fixed 1 decimal
+
+    using Blocked = BlockedSortedVector<int, std::greater<int>>;
+    auto t = static_cast<std::size_t>(*in++);
+    auto v = std::vector<int>(t);
+    std::copy_n(in, t, v.begin());
+    solution(Blocked{}, v.begin(), t, out); // to match expected output
+
+#ifdef REPS // the competing engines, only when benchmarking
+    t = bench_repeat(v, t, 1'000'000); // input repeated up to 10^6 values
+    const auto tvector = std::min<std::size_t>(t, 100'000); // quadratic
+    auto fvector = [&]() {
+        solution(SortedVector{}, v.begin(), tvector, BenchSink{});
+    };
+    auto fblocked_short = [&]() {
+        solution(Blocked{}, v.begin(), tvector, BenchSink{});
+    };
+    auto fblocked = [&]() { solution(Blocked{}, v.begin(), t, BenchSink{}); };
+    auto fblocked2k = [&]() {
+        using Blocked2k = BlockedSortedVector<int, std::greater<int>, 2048>;
+        solution(Blocked2k{}, v.begin(), t, BenchSink{});
+    };
+    const auto name = std::string{argv[0]};
+    bench_header(std::cerr);
+    bench_row(std::cerr, name + ":vector", bench_run(fvector, REPS, tvector));
+    bench_row(std::cerr, name + ":blocked-short",
+              bench_run(fblocked_short, REPS, tvector));
+    bench_row(std::cerr, name + ":blocked", bench_run(fblocked, REPS, t));
+    bench_row(std::cerr, name + ":blocked2k", bench_run(fblocked2k, REPS, t));
+#endif
+    return 0;
+}
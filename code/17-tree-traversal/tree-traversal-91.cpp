@@ -1,10 +1,10 @@
 #include <algorithm> // std::copy_n
-#include <chrono> // std::chrono::xx
 #include <functional> // std::function
 #include <iostream> // std::cout/cin
 #include <iterator> // std::istream/ostream_iterator
 #include <memory> // std::unique_ptr
 #include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
 
 class UniquePtrTree {
     struct Node {
@@ -53,30 +53,22 @@ solution(I in, F fout, int size) {
 
 // Main
 int
-main(int, char *[]) {
+main(int, char *argv[]) {
     auto in = std::istream_iterator<int>{std::cin}; // input iterator
     auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
-    auto oerr = std::ostream_iterator<double>(std::cerr, "\n");
 
-    auto reps = 1;
-#ifdef REPS
-    reps = REPS;
-#endif
     auto t = *in++;
     auto v = std::vector<int>(t);
     auto vin = v.begin();
     std::copy_n(in, t, vin); // vin is not invalidated
 
     auto fout = [&out](auto x){ out = x; };
-    auto fakeout = [](auto){};
 
-    auto start = std::chrono::steady_clock::now();
     solution(vin, fout, t); // to match expected output
-    while(--reps)
-        solution(vin, fakeout, t); // extra rounds for timing, no output
-    auto stop = std::chrono::steady_clock::now();
-    auto elapsed_seconds = std::chrono::
-        duration_cast<std::chrono::duration<double>>(stop - start).count();
-    oerr = elapsed_seconds;
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
     return 0;
 }
@@ -0,0 +1,92 @@
+#include <algorithm> // std::copy_n
+#include <functional> // std::function
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+
+class ArenaTree {
+    struct Node {
+        int m_data;
+        using NodePtr = Node *;
+        NodePtr left = nullptr, right = nullptr;
+        Node(int data) : m_data{data} {};
+    };
+    using NodePtr = Node::NodePtr;
+
+    // Bump allocator: nodes are carved out of contiguous blocks, which are
+    // released all at once with the tree. No delete per node is needed.
+    class Arena {
+        static constexpr auto BlockSize = std::size_t{4096};
+        std::vector<std::vector<Node>> m_blocks; // capacity is never exceeded
+
+    public:
+        Arena(std::size_t hint) { m_blocks.emplace_back().reserve(hint); }
+
+        auto create(int data) {
+            if (m_blocks.back().size() == m_blocks.back().capacity())
+                m_blocks.emplace_back().reserve(BlockSize); // block is full
+            return &m_blocks.back().emplace_back(data); // address is stable
+        }
+    };
+
+    Arena m_arena;
+    NodePtr m_root = nullptr;
+
+    auto insert(int data, NodePtr &node) {
+        if(not node) {
+            node = m_arena.create(data);
+            return;
+        }
+        auto &left_or_right = data < node->m_data ? node->left : node->right;
+        insert(data, left_or_right);
+    }
+
+    using FVisit = std::function<void(int)>;
+
+    auto preorder(const FVisit &fvisit, const NodePtr &node) const {
+        if (not node)
+            return;
+
+        fvisit(node->m_data);
+        preorder(fvisit, node->left);
+        preorder(fvisit, node->right);
+    }
+public:
+    ArenaTree(std::size_t hint = 1) : m_arena{hint} {}
+
+    auto insert(int data) { insert(data, m_root); }
+    auto preorder(const FVisit &fvisit) const { preorder(fvisit, m_root); }
+};
+
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    auto tree = ArenaTree(size); // all nodes fit in the first block
+    while(size--)
+        tree.insert(*in++);
+
+    tree.preorder(fout);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); // vin is not invalidated
+
+    auto fout = [&out](auto x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include <algorithm> // std::copy_n
+#include <cstdint> // std::uint32_t
+#include <functional> // std::function
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+#include "../00-libs/mmap_input_range.hpp" // mmap_input_range
+
+class FlatTree {
+    using Index = std::uint32_t;
+    static constexpr auto NullIndex = Index{}; // slot 0 is the virtual root
+
+    // structure of arrays: the same slot in each array describes a node
+    std::vector<int> m_keys{int{}}; // init tree with empty virtual root
+    std::vector<Index> m_left{NullIndex}, m_right{NullIndex};
+
+    // no ref 2 real root, because the arrays can be reallocated
+    auto root() const { return m_right[NullIndex]; }
+
+    auto create(int data) {
+        m_keys.push_back(data); // new node goes to the end of the arrays
+        m_left.push_back(NullIndex);
+        m_right.push_back(NullIndex);
+        return static_cast<Index>(m_keys.size() - 1);
+    }
+
+    using FVisit = std::function<void(int)>;
+
+public:
+    FlatTree(std::size_t hint = 0) {
+        m_keys.reserve(hint + 1); // account for the virtual root
+        m_left.reserve(hint + 1);
+        m_right.reserve(hint + 1);
+    }
+
+    // no recursion, sorted input makes a tree as deep as the input is long
+    auto insert(int data) {
+        auto node = NullIndex; // virtual root, the real one is on the right
+        for (auto child = root(); child != NullIndex;) {
+            node = child; // already in tree, go deeper
+            child = data < m_keys[node] ? m_left[node] : m_right[node];
+        }
+        auto &children = (node != NullIndex and data < m_keys[node]) ?
+            m_left : m_right;
+        const auto child = create(data); // push_back may move the arrays
+        children[node] = child;
+    }
+
+    // explicit stack, only as deep as the tree is
+    auto preorder(const FVisit &fvisit) const {
+        auto stack = std::vector<Index>{};
+        if (root() != NullIndex)
+            stack.push_back(root());
+
+        while (not stack.empty()) {
+            const auto node = stack.back();
+            stack.pop_back();
+            fvisit(m_keys[node]); // preorder ... out root
+            if (m_right[node] != NullIndex) // pushed 1st, visited 2nd
+                stack.push_back(m_right[node]);
+            if (m_left[node] != NullIndex)
+                stack.push_back(m_left[node]);
+        }
+    }
+
+    // Morris traversal: threads the rightmost node of each left subtree to
+    // its successor, instead of using a stack. The links are restored.
+    auto preorder_morris(const FVisit &fvisit) {
+        for (auto node = root(); node != NullIndex;) {
+            if (m_left[node] == NullIndex) {
+                fvisit(m_keys[node]); // no left side, go right
+                node = m_right[node];
+                continue;
+            }
+            auto pred = m_left[node]; // find the predecessor of node
+            while (m_right[pred] != NullIndex and m_right[pred] != node)
+                pred = m_right[pred];
+
+            if (m_right[pred] == NullIndex) { // 1st time here, add thread
+                fvisit(m_keys[node]); // preorder ... out root
+                m_right[pred] = node;
+                node = m_left[node];
+            } else { // 2nd time here, the left side is done, remove thread
+                m_right[pred] = NullIndex;
+                node = m_right[node];
+            }
+        }
+    }
+};
+
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    auto tree = FlatTree(size); // no reallocation of the arrays
+    while(size--)
+        tree.insert(*in++);
+
+#ifdef CASEMORRIS
+    tree.preorder_morris(fout); // threaded, no stack
+#else
+    tree.preorder(fout); // explicit stack
+#endif
+}
+
+// Main
+int
+main(int, char *argv[]) {
+#if defined(CASEMMAP)
+    const auto input = mmap_input_range<int>{}; // stdin, parsed lazily
+    auto in = input.begin(); // random access
+#elif defined(CASEFASTIO)
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+#endif
+#ifdef CASEFASTIO
+    auto out = fast_ostream_iterator<int>{std::cout, " "}; // write(2)
+#else
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+#endif
+
+    auto t = *in++;
+#ifdef CASEMMAP
+    auto vin = in; // the input is already in memory, no copy needed
+#else
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); // vin is not invalidated
+#endif
+
+    auto fout = [&out](auto x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include <algorithm> // std::copy, std::copy_n, std::max
+#include <array> // std::array
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <unordered_map> // std::unordered_map
+#include <vector> // std::vector
+#include <type_traits> // std::enable_if, std::void_t
+#include "../00-libs/bench.hpp" // bench_run/report, BenchSink
+
+// SFINAE for the Tree Type (operator support)
+template<typename, typename = void>
+constexpr bool op_lt_v = false;
+
+template<typename T>
+constexpr bool
+op_lt_v<T, std::void_t<decltype(std::declval<T>() < std::declval<T>())>> = true;
+
+template<typename, typename = void>
+constexpr bool op_ne_v = false;
+
+template<typename T>
+constexpr bool
+op_ne_v<T, std::void_t<decltype(std::declval<T>() != std::declval<T>())>> = true;
+
+template<typename, typename = void>
+constexpr bool op_eq_v = false;
+
+template<typename T>
+constexpr bool
+op_eq_v<T, std::void_t<decltype(std::declval<T>() == std::declval<T>())>> = true;
+
+template <typename T>
+using enable_if_T_ops =
+    std::enable_if_t<op_lt_v<T> and op_ne_v<T> and op_eq_v<T>>;
+
+// Traversal orders offered by the iterators
+enum class Order { Pre, Post, In };
+
+// Tree Class
+template <typename T = int, typename = enable_if_T_ops<T>>
+class StdTree {
+    static constexpr auto NullTreeVal = T{};
+    enum Node { Left = 0, Right = 1, Total = 2 };
+    using Children = std::array<T, Node::Total>;
+    static constexpr auto NullChildren = Children{NullTreeVal, NullTreeVal};
+
+    // init tree with empty virtual root
+    std::unordered_map<T, Children> m_tree{{NullTreeVal, NullChildren}};
+    const T &m_root = m_tree.at(NullTreeVal)[Node::Right]; // ref 2 real root
+    size_t m_height = 0; // deepest level, to size the iterator stacks
+
+    void insert(const T &data, const T &node, size_t depth) {
+        auto &child = m_tree.at(node)[not (data < node)];
+        if (child != NullTreeVal)
+            return insert(data, child, depth + 1); // in tree, go deeper
+        // not in tree, add it with default empty children
+        m_tree[child = data] = NullChildren; // set target (left or right ref)
+        m_height = std::max(m_height, depth);
+    }
+
+public:
+    // Lazy traversal, the stack holds the current node on top and the nodes
+    // still to be visited below. It is sized once with the tree height.
+    class const_iterator {
+        const StdTree *m_t = nullptr;
+        Order m_order = Order::In;
+        std::vector<T> m_stack; // empty stack => end of traversal
+
+        auto &children(const T &node) const { return m_t->m_tree.at(node); }
+
+        // push nodes until the first to visit in the subtree is on top
+        void descend(T node) {
+            while (node != NullTreeVal) {
+                m_stack.push_back(node);
+                if (m_order == Order::Pre)
+                    return; // root goes first
+                const auto &[left, right] = children(node);
+                if (m_order == Order::In or left != NullTreeVal)
+                    node = left;
+                else
+                    node = right; // post: there is no left side, go right
+            }
+        }
+
+    public:
+        // needed for an iterator
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() {} // end of traversal
+        const_iterator(const StdTree *t, Order order) : m_t{t}, m_order{order} {
+            m_stack.reserve(t->m_height + 1); // no allocation when stepping
+            descend(t->m_root);
+        }
+
+        auto &operator *() const { return m_stack.back(); }
+        auto *operator ->() const { return &m_stack.back(); }
+
+        auto &operator ++() { // Prefix increment
+            const auto node = m_stack.back();
+            m_stack.pop_back();
+            const auto &[left, right] = children(node);
+            if (m_order == Order::Pre) {
+                if (right != NullTreeVal) // pushed 1st, visited 2nd
+                    m_stack.push_back(right);
+                if (left != NullTreeVal)
+                    m_stack.push_back(left);
+            } else if (m_order == Order::In)
+                descend(right); // parent is already waiting on the stack
+            else if (not m_stack.empty()) { // Order::Post, go to the parent
+                const auto &[pleft, pright] = children(m_stack.back());
+                if (node == pleft) // parent waits for its right side
+                    descend(pright);
+            }
+            return *this;
+        }
+        // Postfix increment
+        auto operator ++(int) { auto tmp = *this; ++(*this); return tmp; }
+
+        auto operator ==(const const_iterator &o) const {
+            if (m_stack.size() != o.m_stack.size())
+                return false;
+            return m_stack.empty() or m_stack.back() == o.m_stack.back();
+        }
+        auto operator !=(const const_iterator &o) const {
+            return not (*this == o);
+        }
+    };
+
+    // start always with the virtual root value
+    auto insert(const T &data) { insert(data, NullTreeVal, 1); }
+
+    template <Order order>
+    auto begin() const { return const_iterator{this, order}; }
+    auto end() const { return const_iterator{}; }
+};
+
+// Solution Function
+template <typename I, typename O>
+auto
+solution(I in, O out, int size) {
+    auto tree = StdTree<>{};
+    while(size--)
+        tree.insert(*in++);
+
+    std::copy(tree.begin<Order::Post>(), tree.end(), out);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); //
+
+    solution(vin, out, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fbench = [&]() { solution(vin, BenchSink{}, t); }; // discarded
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include <algorithm> // std::copy_n, std::stable_sort
+#include <array> // std::array
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <unordered_map> // std::unordered_map
+#include <utility> // std::pair
+#include <vector> // std::vector
+#include <type_traits> // std::enable_if, std::invoke_result, std::void_t
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+
+// SFINAE for the Tree Type (operator support)
+template<typename, typename = void>
+constexpr bool op_lt_v = false;
+
+template<typename T>
+constexpr bool
+op_lt_v<T, std::void_t<decltype(std::declval<T>() < std::declval<T>())>> = true;
+
+template<typename, typename = void>
+constexpr bool op_ne_v = false;
+
+template<typename T>
+constexpr bool
+op_ne_v<T, std::void_t<decltype(std::declval<T>() != std::declval<T>())>> = true;
+
+template<typename, typename = void>
+constexpr bool op_eq_v = false;
+
+template<typename T>
+constexpr bool
+op_eq_v<T, std::void_t<decltype(std::declval<T>() == std::declval<T>())>> = true;
+
+template <typename T>
+using enable_if_T_ops =
+    std::enable_if_t<op_lt_v<T> and op_ne_v<T> and op_eq_v<T>>;
+
+// SFINAE: Visiting Function
+template<typename, typename, typename = void>
+constexpr bool f_visit = false;
+
+template<typename F, typename T>
+constexpr bool
+f_visit<F, T, std::void_t<std::invoke_result_t<F, T>>> = true;
+
+template <typename F, typename T>
+using enable_if_fvisit = std::enable_if_t<f_visit<F, T>>;
+
+// SFINAE: Input Iterator for the bulk construction
+template <typename I>
+using it_type = typename std::iterator_traits<I>::value_type;
+
+template <typename I>
+constexpr bool is_input_v = std::is_base_of_v<std::input_iterator_tag,
+    typename std::iterator_traits<I>::iterator_category>;
+
+template <typename I>
+using enable_if_input = std::enable_if_t<is_input_v<I>>;
+
+// Tree Class
+template <typename T = int, typename = enable_if_T_ops<T>>
+class StdTree {
+    static constexpr auto NullTreeVal = T{};
+    enum Node { Left = 0, Right = 1, Total = 2 };
+    using Children = std::array<T, Node::Total>;
+    static constexpr auto NullChildren = Children{NullTreeVal, NullTreeVal};
+
+    // init tree with empty virtual root
+    std::unordered_map<T, Children> m_tree{{NullTreeVal, NullChildren}};
+    const T &m_root = m_tree.at(NullTreeVal)[Node::Right]; // ref 2 real root
+
+    enum class Order { Pre, Post, In };
+
+    template <Order order, typename F, typename = enable_if_fvisit<F, T>>
+    auto visit(const F &fvisit, const T &node) const {
+        if (node == NullTreeVal)
+            return; // if empty ... will do nothing
+
+        const auto &[left, right] = m_tree.at(node); // get children
+        if constexpr (order == Order::Pre) fvisit(node); // pre -> root
+        visit<order>(fvisit, left); // visit left
+        if constexpr (order == Order::In) fvisit(node); // inorder -> root
+        visit<order>(fvisit, right); // visit right
+        if constexpr (order == Order::Post) fvisit(node); // post -> root
+    }
+
+    void insert(const T &data, const T &node) {
+        auto &child = m_tree.at(node)[not (data < node)];
+        if (child != NullTreeVal)
+            return insert(data, child); // already in tree, go deeper
+        // not in tree, add it with default empty children
+        m_tree[child = data] = NullChildren; // set target (left or right ref)
+    }
+
+public:
+    StdTree() {}
+
+    // Bulk construction with the same shape as inserting one by one. That
+    // shape is the cartesian tree of the keys, with the insertion order as
+    // heap priority (earlier is closer to the root). Sorting the keys and
+    // linking them with a stack avoids descending from the root each time.
+    template <typename I, typename = enable_if_input<I>>
+    StdTree(I first, I last) {
+        auto nodes = std::vector<std::pair<T, size_t>>{}; // key, order
+        for (auto order = size_t{}; first != last; ++first, ++order)
+            nodes.emplace_back(*first, order);
+
+        // insert sends equal keys right, i.e.: the later one is "greater"
+        std::stable_sort(nodes.begin(), nodes.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+
+        m_tree.reserve(nodes.size() + 1); // account for the virtual root
+        auto stack = std::vector<size_t>{}; // right spine, as nodes indices
+        for (auto i = size_t{}; i < nodes.size(); ++i) {
+            const auto &[key, order] = nodes[i];
+            while (not stack.empty() and nodes[stack.back()].second > order)
+                stack.pop_back(); // inserted after key, it goes below key
+            // key takes over the right link of the spine (or the root) and
+            // what hung there, smaller keys inserted later, goes left of key
+            const auto &parent = stack.empty() ?
+                NullTreeVal : nodes[stack.back()].first;
+            auto &link = m_tree.at(parent)[Node::Right];
+            m_tree[key] = Children{link, NullTreeVal}; // refs are stable
+            link = key;
+            stack.push_back(i);
+        }
+    }
+
+    // start always with the virtual root value
+    auto insert(const T &data) { insert(data, NullTreeVal); }
+    // start with the reference to the real root
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto preorder(const F &fvisit) const { visit<Order::Pre>(fvisit, m_root); }
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto inorder(const F &fvisit) const { visit<Order::In>(fvisit, m_root); }
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto postorder(const F &fvisit) const { visit<Order::Post>(fvisit, m_root); }
+};
+
+// Deduce the type of the tree from the type of the iterator
+template <typename I, typename = enable_if_input<I>>
+StdTree(I, I) -> StdTree<it_type<I>>;
+
+// Solution Function
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    const auto tree = StdTree(in, std::next(in, size)); // bulk construction
+    tree.postorder(fout);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); //
+
+    auto fout = [&out](const auto &x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
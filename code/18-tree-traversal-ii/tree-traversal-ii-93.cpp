@@ -0,0 +1,131 @@
+#include <algorithm> // std::copy_n
+#include <cstdint> // std::uint32_t
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <vector> // std::vector
+#include <type_traits> // std::enable_if, std::invoke_result, std::void_t
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+
+// SFINAE for the Tree Type (operator support)
+template<typename, typename = void>
+constexpr bool op_lt_v = false;
+
+template<typename T>
+constexpr bool
+op_lt_v<T, std::void_t<decltype(std::declval<T>() < std::declval<T>())>> = true;
+
+template <typename T>
+using enable_if_T_ops = std::enable_if_t<op_lt_v<T>>;
+
+// SFINAE: Visiting Function
+template<typename, typename, typename = void>
+constexpr bool f_visit = false;
+
+template<typename F, typename T>
+constexpr bool
+f_visit<F, T, std::void_t<std::invoke_result_t<F, T>>> = true;
+
+template <typename F, typename T>
+using enable_if_fvisit = std::enable_if_t<f_visit<F, T>>;
+
+// Tree Class
+template <typename T = int, typename = enable_if_T_ops<T>>
+class FlatTree {
+    using Index = std::uint32_t;
+    static constexpr auto NullIndex = Index{}; // slot 0 is the virtual root
+
+    // structure of arrays: the same slot in each array describes a node
+    std::vector<T> m_keys{T{}}; // init tree with empty virtual root
+    std::vector<Index> m_left{NullIndex}, m_right{NullIndex};
+
+    // no ref 2 real root, because the arrays can be reallocated
+    auto root() const { return m_right[NullIndex]; }
+
+    enum class Order { Pre, Post, In };
+
+    template <Order order, typename F, typename = enable_if_fvisit<F, T>>
+    auto visit(const F &fvisit, Index node) const {
+        if (node == NullIndex)
+            return; // if empty ... will do nothing
+
+        if constexpr (order == Order::Pre) fvisit(m_keys[node]); // pre
+        visit<order>(fvisit, m_left[node]); // visit left
+        if constexpr (order == Order::In) fvisit(m_keys[node]); // inorder
+        visit<order>(fvisit, m_right[node]); // visit right
+        if constexpr (order == Order::Post) fvisit(m_keys[node]); // post
+    }
+
+    auto create(const T &data) {
+        m_keys.push_back(data); // new node goes to the end of the arrays
+        m_left.push_back(NullIndex);
+        m_right.push_back(NullIndex);
+        return static_cast<Index>(m_keys.size() - 1);
+    }
+
+    void insert(const T &data, Index node) {
+        auto &children = data < m_keys[node] ? m_left : m_right;
+        if (children[node] != NullIndex)
+            return insert(data, children[node]); // already in tree, go deeper
+        // not in tree, create it first, push_back may have moved the arrays
+        const auto child = create(data);
+        children[node] = child;
+    }
+
+public:
+    FlatTree(std::size_t hint = 0) { reserve(hint); }
+
+    auto reserve(std::size_t size) {
+        m_keys.reserve(size + 1); // account for the virtual root
+        m_left.reserve(size + 1);
+        m_right.reserve(size + 1);
+    }
+
+    auto insert(const T &data) {
+        if (root() != NullIndex)
+            return insert(data, root()); // real root defined, go down
+
+        const auto node = create(data); // create before taking the ref
+        m_right[NullIndex] = node;
+    }
+
+    // start with the real root
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto preorder(const F &fvisit) const { visit<Order::Pre>(fvisit, root()); }
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto inorder(const F &fvisit) const { visit<Order::In>(fvisit, root()); }
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto postorder(const F &fvisit) const { visit<Order::Post>(fvisit, root()); }
+};
+
+// Solution Function
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    auto tree = FlatTree(size); // no reallocation of the arrays
+    while(size--)
+        tree.insert(*in++);
+
+    tree.postorder(fout);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); //
+
+    auto fout = [&out](const auto &x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
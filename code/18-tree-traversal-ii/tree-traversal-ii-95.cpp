@@ -0,0 +1,135 @@
+#include <algorithm> // std::copy, std::copy_n, std::max
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <memory> // std::unique_ptr
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/report, BenchSink
+
+// Traversal orders offered by the iterators
+enum class Order { Pre, Post, In };
+
+template <class T = int>
+class UniquePtrTree {
+    struct Node {
+        T m_data;
+        using NodePtr = std::unique_ptr<Node>;
+        NodePtr left, right;
+        Node(const T &data) : m_data{data} {};
+        auto static create(const T &d) { return std::make_unique<Node>(d); }
+    };
+
+    using NodePtr = typename Node::NodePtr;
+    NodePtr m_root;
+    size_t m_height = 0; // deepest level, to size the iterator stacks
+
+    auto insert(const T &data, NodePtr &node, size_t depth) {
+        if(not node) {
+            node = Node::create(data);
+            m_height = std::max(m_height, depth);
+            return;
+        }
+        insert(data, data < node->m_data ? node->left : node->right, depth + 1);
+    }
+
+public:
+    // Lazy traversal, the stack holds the current node on top and the nodes
+    // still to be visited below. It is sized once with the tree height.
+    class const_iterator {
+        Order m_order = Order::In;
+        std::vector<const Node *> m_stack; // empty stack => end of traversal
+
+        // push nodes until the first to visit in the subtree is on top
+        void descend(const Node *node) {
+            while (node) {
+                m_stack.push_back(node);
+                if (m_order == Order::Pre)
+                    return; // root goes first
+                if (m_order == Order::In or node->left)
+                    node = node->left.get();
+                else
+                    node = node->right.get(); // post: no left side, go right
+            }
+        }
+
+    public:
+        // needed for an iterator
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() {} // end of traversal
+        const_iterator(const UniquePtrTree *t, Order order) : m_order{order} {
+            m_stack.reserve(t->m_height + 1); // no allocation when stepping
+            descend(t->m_root.get());
+        }
+
+        auto &operator *() const { return m_stack.back()->m_data; }
+        auto *operator ->() const { return &m_stack.back()->m_data; }
+
+        auto &operator ++() { // Prefix increment
+            const auto *node = m_stack.back();
+            m_stack.pop_back();
+            if (m_order == Order::Pre) {
+                if (node->right) // pushed 1st, visited 2nd
+                    m_stack.push_back(node->right.get());
+                if (node->left)
+                    m_stack.push_back(node->left.get());
+            } else if (m_order == Order::In)
+                descend(node->right.get()); // parent is waiting on the stack
+            else if (not m_stack.empty()) { // Order::Post, go to the parent
+                const auto *parent = m_stack.back();
+                if (node == parent->left.get()) // parent waits for right side
+                    descend(parent->right.get());
+            }
+            return *this;
+        }
+        // Postfix increment
+        auto operator ++(int) { auto tmp = *this; ++(*this); return tmp; }
+
+        auto operator ==(const const_iterator &o) const {
+            if (m_stack.size() != o.m_stack.size())
+                return false;
+            return m_stack.empty() or m_stack.back() == o.m_stack.back();
+        }
+        auto operator !=(const const_iterator &o) const {
+            return not (*this == o);
+        }
+    };
+
+    auto insert(const T &data) { insert(data, m_root, 1); };
+
+    template <Order order>
+    auto begin() const { return const_iterator{this, order}; }
+    auto end() const { return const_iterator{}; }
+};
+
+template <typename I, typename O>
+auto
+solution(I in, O out, int size) {
+    auto tree = UniquePtrTree<>{};
+    while(size--)
+        tree.insert(*in++);
+
+    std::copy(tree.begin<Order::Post>(), tree.end(), out);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); // vin is not invalidated
+
+    solution(vin, out, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fbench = [&]() { solution(vin, BenchSink{}, t); }; // discarded
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <algorithm> // std::copy_n, std::stable_sort
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <memory> // std::unique_ptr
+#include <utility> // std::pair
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+
+template <typename I>
+using it_type = typename std::iterator_traits<I>::value_type;
+
+template <class T = int>
+class UniquePtrTree {
+    struct Node {
+        T m_data;
+        using NodePtr = std::unique_ptr<Node>;
+        NodePtr left, right;
+        Node(const T &data) : m_data{data} {};
+        auto static create(const T &d) { return std::make_unique<Node>(d); }
+    };
+
+    using NodePtr = typename Node::NodePtr;
+    NodePtr m_root;
+
+    auto insert(const T &data, NodePtr &node) {
+        if(not node) {
+            node = Node::create(data);
+            return;
+        }
+        insert(data, data < node->m_data ? node->left : node->right);
+    }
+
+    enum class Order { Pre, Post, In };
+
+    template <Order order, typename F>
+    auto visit(const F &fvisit, const NodePtr &node) const {
+        if (not node)
+            return;
+
+        if constexpr (order == Order::Pre) fvisit(node->m_data); // pre
+        visit<order>(fvisit, node->left); // visit left
+        if constexpr (order == Order::In) fvisit(node->m_data); // inorder
+        visit<order>(fvisit, node->right); // visit right
+        if constexpr (order == Order::Post) fvisit(node->m_data); // post
+    }
+
+public:
+    UniquePtrTree() {}
+
+    // Bulk construction with the same shape as inserting one by one. That
+    // shape is the cartesian tree of the keys, with the insertion order as
+    // heap priority (earlier is closer to the root). Sorting the keys and
+    // linking them with a stack avoids descending from the root each time.
+    template <typename I>
+    UniquePtrTree(I first, I last) {
+        auto nodes = std::vector<std::pair<T, size_t>>{}; // key, order
+        for (auto order = size_t{}; first != last; ++first, ++order)
+            nodes.emplace_back(*first, order);
+
+        // insert sends equal keys right, i.e.: the later one is "greater"
+        std::stable_sort(nodes.begin(), nodes.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+
+        auto stack = std::vector<std::pair<Node *, size_t>>{}; // right spine
+        for (const auto &[key, order] : nodes) {
+            while (not stack.empty() and stack.back().second > order)
+                stack.pop_back(); // inserted after key, it goes below key
+            // key takes over the right link of the spine (or the root) and
+            // what hung there, smaller keys inserted later, goes left of key
+            auto &link = stack.empty() ? m_root : stack.back().first->right;
+            auto node = Node::create(key);
+            node->left = std::move(link);
+            link = std::move(node);
+            stack.emplace_back(link.get(), order);
+        }
+    }
+
+    auto insert(const T &data) { insert(data, m_root); };
+
+    template <typename F>
+    auto preorder(const F &fvisit) const { visit<Order::Pre>(fvisit, m_root); }
+    template <typename F>
+    auto postorder(const F &fvisit) const { visit<Order::Post>(fvisit, m_root); }
+    template <typename F>
+    auto inorder(const F &fvisit) const { visit<Order::In>(fvisit, m_root); }
+};
+
+// Deduce the type of the tree from the type of the iterator
+template <typename I>
+UniquePtrTree(I, I) -> UniquePtrTree<it_type<I>>;
+
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    const auto tree = UniquePtrTree(in, std::next(in, size)); // bulk build
+    tree.postorder(fout);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); // vin is not invalidated
+
+    auto fout = [&out](const auto &x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
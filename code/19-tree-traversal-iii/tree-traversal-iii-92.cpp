@@ -0,0 +1,102 @@
+#include <algorithm> // std::copy_n
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <vector> // std::vector
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+
+template <class T = int>
+class ArenaTree {
+    struct Node {
+        T m_data;
+        using NodePtr = Node *;
+        NodePtr left = nullptr, right = nullptr;
+        Node(const T &data) : m_data{data} {};
+    };
+
+    using NodePtr = typename Node::NodePtr;
+
+    // Bump allocator: nodes are carved out of contiguous blocks, which are
+    // released all at once with the tree. No delete per node is needed.
+    class Arena {
+        static constexpr auto BlockSize = std::size_t{4096};
+        std::vector<std::vector<Node>> m_blocks; // capacity is never exceeded
+
+    public:
+        Arena(std::size_t hint) { m_blocks.emplace_back().reserve(hint); }
+
+        auto create(const T &data) {
+            if (m_blocks.back().size() == m_blocks.back().capacity())
+                m_blocks.emplace_back().reserve(BlockSize); // block is full
+            return &m_blocks.back().emplace_back(data); // address is stable
+        }
+    };
+
+    Arena m_arena;
+    NodePtr m_root = nullptr;
+
+    auto insert(const T &data, NodePtr &node) {
+        if(not node) {
+            node = m_arena.create(data);
+            return;
+        }
+        insert(data, data < node->m_data ? node->left : node->right);
+    }
+
+    enum class Order { Pre, Post, In };
+
+    template <Order order, typename F>
+    auto visit(const F &fvisit, const NodePtr &node) const {
+        if (not node)
+            return;
+
+        if constexpr (order == Order::Pre) fvisit(node->m_data); // pre
+        visit<order>(fvisit, node->left); // visit left
+        if constexpr (order == Order::In) fvisit(node->m_data); // inorder
+        visit<order>(fvisit, node->right); // visit right
+        if constexpr (order == Order::Post) fvisit(node->m_data); // post
+    }
+
+public:
+    ArenaTree(std::size_t hint = 1) : m_arena{hint} {}
+
+    auto insert(const T &data) { insert(data, m_root); };
+
+    template <typename F>
+    auto preorder(const F &fvisit) const { visit<Order::Pre>(fvisit, m_root); }
+    template <typename F>
+    auto postorder(const F &fvisit) const { visit<Order::Post>(fvisit, m_root); }
+    template <typename F>
+    auto inorder(const F &fvisit) const { visit<Order::In>(fvisit, m_root); }
+};
+
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    auto tree = ArenaTree(size); // all nodes fit in the first block
+    while(size--)
+        tree.insert(*in++);
+
+    tree.inorder(fout);
+}
+
+// Main
+int
+main(int, char *argv[]) {
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); // vin is not invalidated
+
+    auto fout = [&out](const auto &x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}
@@ -0,0 +1,219 @@
+#include <algorithm> // std::copy_n
+#include <cstdint> // std::uint32_t
+#include <iostream> // std::cout/cin
+#include <iterator> // std::istream/ostream_iterator
+#include <vector> // std::vector
+#include <type_traits> // std::enable_if, std::invoke_result, std::void_t
+#include "../00-libs/bench.hpp" // bench_run/report, do_not_optimize
+#include "../00-libs/fast_istream_iterator.hpp" // fast_istream_iterator
+#include "../00-libs/fast_ostream_iterator.hpp" // fast_ostream_iterator
+
+// SFINAE for the Tree Type (operator support)
+template<typename, typename = void>
+constexpr bool op_lt_v = false;
+
+template<typename T>
+constexpr bool
+op_lt_v<T, std::void_t<decltype(std::declval<T>() < std::declval<T>())>> = true;
+
+template <typename T>
+using enable_if_T_ops = std::enable_if_t<op_lt_v<T>>;
+
+// SFINAE: Visiting Function
+template<typename, typename, typename = void>
+constexpr bool f_visit = false;
+
+template<typename F, typename T>
+constexpr bool
+f_visit<F, T, std::void_t<std::invoke_result_t<F, T>>> = true;
+
+template <typename F, typename T>
+using enable_if_fvisit = std::enable_if_t<f_visit<F, T>>;
+
+// Traversal engine: explicit stack or Morris threading (no extra memory)
+enum class Walk { Stack, Morris };
+
+// Tree Class
+template <typename T = int, typename = enable_if_T_ops<T>>
+class FlatTree {
+    using Index = std::uint32_t;
+    static constexpr auto NullIndex = Index{}; // slot 0 is the virtual root
+
+    // structure of arrays: the same slot in each array describes a node
+    std::vector<T> m_keys{T{}}; // init tree with empty virtual root
+    std::vector<Index> m_left{NullIndex}, m_right{NullIndex};
+
+    // no ref 2 real root, because the arrays can be reallocated
+    auto root() const { return m_right[NullIndex]; }
+
+    enum class Order { Pre, Post, In };
+
+    // explicit stack, only as deep as the tree is, no recursion
+    template <Order order, typename F, typename = enable_if_fvisit<F, T>>
+    auto visit(const F &fvisit) const {
+        auto stack = std::vector<Index>{};
+        if constexpr (order == Order::Pre) {
+            if (root() != NullIndex)
+                stack.push_back(root());
+
+            while (not stack.empty()) {
+                const auto node = stack.back();
+                stack.pop_back();
+                fvisit(m_keys[node]); // pre -> root
+                if (m_right[node] != NullIndex) // pushed 1st, visited 2nd
+                    stack.push_back(m_right[node]);
+                if (m_left[node] != NullIndex)
+                    stack.push_back(m_left[node]);
+            }
+        } else if constexpr (order == Order::In) {
+            for (auto node = root(); node != NullIndex or not stack.empty();) {
+                for (; node != NullIndex; node = m_left[node])
+                    stack.push_back(node); // go down the left side
+                node = stack.back();
+                stack.pop_back();
+                fvisit(m_keys[node]); // inorder -> root
+                node = m_right[node]; // and then the right side
+            }
+        } else { // Order::Post
+            auto last = NullIndex; // last visited node
+            for (auto node = root(); node != NullIndex or not stack.empty();) {
+                if (node != NullIndex) {
+                    stack.push_back(node); // go down the left side
+                    node = m_left[node];
+                    continue;
+                }
+                const auto top = stack.back();
+                if (m_right[top] != NullIndex and m_right[top] != last) {
+                    node = m_right[top]; // right side not yet visited
+                    continue;
+                }
+                fvisit(m_keys[top]); // post -> root
+                last = top;
+                stack.pop_back();
+            }
+        }
+    }
+
+    // Morris traversal: threads the rightmost node of each left subtree to
+    // its successor, instead of using a stack. The links are restored.
+    template <Order order, typename F, typename = enable_if_fvisit<F, T>>
+    auto thread(const F &fvisit) {
+        static_assert(order != Order::Post, "Morris is only pre or inorder");
+
+        for (auto node = root(); node != NullIndex;) {
+            if (m_left[node] == NullIndex) {
+                fvisit(m_keys[node]); // no left side, root is next
+                node = m_right[node];
+                continue;
+            }
+            auto pred = m_left[node]; // find the predecessor of node
+            while (m_right[pred] != NullIndex and m_right[pred] != node)
+                pred = m_right[pred];
+
+            if (m_right[pred] == NullIndex) { // 1st time here, add thread
+                if constexpr (order == Order::Pre) fvisit(m_keys[node]);
+                m_right[pred] = node;
+                node = m_left[node];
+            } else { // 2nd time here, the left side is done, remove thread
+                if constexpr (order == Order::In) fvisit(m_keys[node]);
+                m_right[pred] = NullIndex;
+                node = m_right[node];
+            }
+        }
+    }
+
+    auto create(const T &data) {
+        m_keys.push_back(data); // new node goes to the end of the arrays
+        m_left.push_back(NullIndex);
+        m_right.push_back(NullIndex);
+        return static_cast<Index>(m_keys.size() - 1);
+    }
+
+    void insert(const T &data, Index node) {
+        for (;;) {
+            auto &children = data < m_keys[node] ? m_left : m_right;
+            if (children[node] == NullIndex)
+                break; // not in tree, insert here
+            node = children[node]; // already in tree, go deeper
+        }
+        // create it first, push_back may have moved the arrays
+        auto &children = data < m_keys[node] ? m_left : m_right;
+        const auto child = create(data);
+        children[node] = child;
+    }
+
+public:
+    FlatTree(std::size_t hint = 0) { reserve(hint); }
+
+    auto reserve(std::size_t size) {
+        m_keys.reserve(size + 1); // account for the virtual root
+        m_left.reserve(size + 1);
+        m_right.reserve(size + 1);
+    }
+
+    auto insert(const T &data) {
+        if (root() != NullIndex)
+            return insert(data, root()); // real root defined, go down
+
+        const auto node = create(data); // create before taking the ref
+        m_right[NullIndex] = node;
+    }
+
+    // the Morris walk temporarily modifies the links, hence not const
+    template <Walk walk = Walk::Stack, typename F,
+              typename = enable_if_fvisit<F, T>>
+    auto preorder(const F &fvisit) {
+        if constexpr (walk == Walk::Morris) thread<Order::Pre>(fvisit);
+        else visit<Order::Pre>(fvisit);
+    }
+    template <Walk walk = Walk::Stack, typename F,
+              typename = enable_if_fvisit<F, T>>
+    auto inorder(const F &fvisit) {
+        if constexpr (walk == Walk::Morris) thread<Order::In>(fvisit);
+        else visit<Order::In>(fvisit);
+    }
+    template <typename F, typename = enable_if_fvisit<F, T>>
+    auto postorder(const F &fvisit) const { visit<Order::Post>(fvisit); }
+};
+
+// Solution Function
+template <typename I, typename F>
+auto
+solution(I in, F fout, int size) {
+    auto tree = FlatTree<>(size); // no reallocation of the arrays
+    while(size--)
+        tree.insert(*in++);
+
+#ifdef CASEMORRIS
+    tree.inorder<Walk::Morris>(fout); // threaded, no stack
+#else
+    tree.inorder(fout); // explicit stack
+#endif
+}
+
+// Main
+int
+main(int, char *argv[]) {
+#ifdef CASEFASTIO
+    auto in = fast_istream_iterator<int>{std::cin}; // read(2), by hand
+    auto out = fast_ostream_iterator<int>{std::cout, " "}; // write(2)
+#else
+    auto in = std::istream_iterator<int>{std::cin}; // input iterator
+    auto out = std::ostream_iterator<int>{std::cout, " "}; // out iter
+#endif
+
+    auto t = *in++;
+    auto v = std::vector<int>(t);
+    auto vin = v.begin();
+    std::copy_n(in, t, vin); //
+
+    auto fout = [&out](const auto &x){ out = x; };
+
+    solution(vin, fout, t); // to match expected output
+#ifdef REPS // the timed runs, only when benchmarking
+    auto fakeout = [](const auto &x){ do_not_optimize(x); }; // sink
+    auto fbench = [&]() { solution(vin, fakeout, t); }; // output nothing
+    bench_report(std::cerr, argv[0], bench_run(fbench, REPS, t));
+#endif
+    return 0;
+}